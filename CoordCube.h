@@ -0,0 +1,153 @@
+#ifndef COORD_CUBE_H
+#define COORD_CUBE_H
+
+#include "Coordinates.h"
+
+/* 좌표 기반 큐브 상태 엔진
+ *
+ * corner_pos/corner_ori/edge_pos/edge_ori 배열 대신 큐브의 상태를 몇 개의 정수(좌표)로 표현합니다.
+ * 각 좌표마다 "좌표 x 회전 -> 좌표" 표를 미리 만들어 두므로, 18가지 회전 중 어느 것이든
+ * 좌표 하나당 표 조회 한 번으로 끝납니다. 탐색 기반 해법(2-phase 등)의 기반으로 사용합니다.
+ *
+ * 좌표: twist        코너 방향       0..2186  (3^7, 마지막 코너의 방향은 나머지로 결정됩니다)
+ *       flip         엣지 방향       0..2047  (2^11, 마지막 엣지의 방향은 나머지로 결정됩니다)
+ *       corner_perm  코너 위치       0..40319 (8!)
+ *       edge4[3]     엣지 네 개씩 묶은 세 그룹(윗면 0~3, 가운데 층 4~7, 아랫면 8~11)의
+ *                    위치와 순서     0..11879 (12 * 11 * 10 * 9)
+ * 엣지 위치는 12!이라서 표로 만들 수 없으므로 세 그룹으로 나누어 저장하며, 세 좌표를 합치면 상태가 완전히 복원됩니다.
+ * edge4 좌표를 24로 나눈 몫(0..494)은 그 그룹이 차지한 자리의 조합, 나머지(0..23)는 그룹 안의 순서입니다.
+ * 모든 좌표는 맞춰진 상태에서 0입니다.
+ *
+ * 회전은 VirtualCube.h의 회전 번호(move, 0..17)로 다룹니다.
+ *
+ * 표 전체가 약 4MB이므로 호스트 전용입니다. coord_init()을 한 번 호출한 뒤에 사용합니다.
+ */
+
+struct CoordCube {
+  uint16_t twist;
+  uint16_t flip;
+  uint16_t corner_perm;
+  uint16_t edge4[3];
+};
+
+/* 1. 좌표 <-> 배열 변환 */
+inline void coord_from_cubies(CoordCube& coord, const uint8_t c_pos[8], const uint8_t c_ori[8], const uint8_t e_pos[12], const uint8_t e_ori[12]) {
+  coord.twist = get_twist(c_ori);
+  coord.flip = get_flip(e_ori);
+  coord.corner_perm = get_corner_perm(c_pos);
+  for (uint8_t group = 0; group < 3; ++group) {
+    coord.edge4[group] = get_edge4(e_pos, group);
+  }
+}
+inline void coord_to_cubies(const CoordCube& coord, uint8_t c_pos[8], uint8_t c_ori[8], uint8_t e_pos[12], uint8_t e_ori[12]) {
+  set_twist(c_ori, coord.twist);
+  set_flip(e_ori, coord.flip);
+  set_corner_perm(c_pos, coord.corner_perm);
+  for (uint8_t group = 0; group < 3; ++group) {
+    set_edge4(e_pos, group, coord.edge4[group]);
+  }
+}
+// 전역 상태(cube_update()가 rotate()로 갱신하는 상태)와 좌표 사이의 변환입니다.
+inline CoordCube coord_from_cube() {
+  uint8_t c_pos[8], c_ori[8], e_pos[12], e_ori[12];
+  cube.unpack(c_pos, c_ori, e_pos, e_ori);
+  CoordCube coord;
+  coord_from_cubies(coord, c_pos, c_ori, e_pos, e_ori);
+  return coord;
+}
+inline void coord_to_cube(const CoordCube& coord) {
+  uint8_t c_pos[8], c_ori[8], e_pos[12], e_ori[12];
+  coord_to_cubies(coord, c_pos, c_ori, e_pos, e_ori);
+  cube = CubeState::pack(c_pos, c_ori, e_pos, e_ori);
+}
+
+/* 2. 회전 표
+ *
+ * table[좌표][회전 번호] = 회전 후의 좌표입니다.
+ * ud_edge_perm_move_table은 G1 안의 회전(is_g1_move())에 대해서만 채워지고 나머지는 COORD_INVALID입니다.
+ */
+uint16_t twist_move_table[TWIST_COUNT][MOVE_COUNT];
+uint16_t flip_move_table[FLIP_COUNT][MOVE_COUNT];
+uint16_t corner_perm_move_table[CORNER_PERM_COUNT][MOVE_COUNT];
+uint16_t edge4_move_table[3][EDGE4_COUNT][MOVE_COUNT];
+uint16_t ud_edge_perm_move_table[UD_EDGE_PERM_COUNT][MOVE_COUNT];
+bool coord_tables_ready = false;
+
+inline void coord_init() {
+  if (coord_tables_ready) {
+    return;
+  }
+
+  uint8_t c_pos[8] = {}, c_ori[8] = {}, e_pos[12] = {}, e_ori[12] = {};
+  // 각 표는 해당 좌표가 담당하는 칸만 바꿔 가며, 축마다 90도씩 세 번 돌려서 count 1, 2, 3의 결과를 얻습니다.
+  for (uint16_t twist = 0; twist < TWIST_COUNT; ++twist) {
+    for (uint8_t axis = 0; axis < 6; ++axis) {
+      set_corner_perm(c_pos, 0);
+      set_twist(c_ori, twist);
+      for (uint8_t count = 0; count < 3; ++count) {
+        turn_cubies(c_pos, c_ori, e_pos, e_ori, axis);
+        twist_move_table[twist][axis * 3 + count] = get_twist(c_ori);
+      }
+    }
+  }
+  for (uint16_t flip = 0; flip < FLIP_COUNT; ++flip) {
+    for (uint8_t axis = 0; axis < 6; ++axis) {
+      memset(e_pos, 0, sizeof(e_pos));
+      set_flip(e_ori, flip);
+      for (uint8_t count = 0; count < 3; ++count) {
+        turn_cubies(c_pos, c_ori, e_pos, e_ori, axis);
+        flip_move_table[flip][axis * 3 + count] = get_flip(e_ori);
+      }
+    }
+  }
+  for (uint16_t corner_perm = 0; corner_perm < CORNER_PERM_COUNT; ++corner_perm) {
+    for (uint8_t axis = 0; axis < 6; ++axis) {
+      set_corner_perm(c_pos, corner_perm);
+      memset(c_ori, 0, sizeof(c_ori));
+      for (uint8_t count = 0; count < 3; ++count) {
+        turn_cubies(c_pos, c_ori, e_pos, e_ori, axis);
+        corner_perm_move_table[corner_perm][axis * 3 + count] = get_corner_perm(c_pos);
+      }
+    }
+  }
+  for (uint8_t group = 0; group < 3; ++group) {
+    for (uint16_t edge4 = 0; edge4 < EDGE4_COUNT; ++edge4) {
+      for (uint8_t axis = 0; axis < 6; ++axis) {
+        memset(e_pos, 0xFF, sizeof(e_pos));  // 그룹 밖의 엣지는 계산에 쓰이지 않습니다.
+        memset(e_ori, 0, sizeof(e_ori));
+        set_edge4(e_pos, group, edge4);
+        for (uint8_t count = 0; count < 3; ++count) {
+          turn_cubies(c_pos, c_ori, e_pos, e_ori, axis);
+          edge4_move_table[group][edge4][axis * 3 + count] = get_edge4(e_pos, group);
+        }
+      }
+    }
+  }
+  for (uint16_t ud_edge_perm = 0; ud_edge_perm < UD_EDGE_PERM_COUNT; ++ud_edge_perm) {
+    for (uint8_t move = 0; move < MOVE_COUNT; ++move) {
+      if (!is_g1_move(move)) {
+        ud_edge_perm_move_table[ud_edge_perm][move] = COORD_INVALID;
+        continue;
+      }
+      set_ud_edge_perm(e_pos, ud_edge_perm);
+      set_edge4(e_pos, EDGE_GROUP_SLICE, 0);
+      memset(e_ori, 0, sizeof(e_ori));
+      turn_cubies_move(c_pos, c_ori, e_pos, e_ori, move);
+      ud_edge_perm_move_table[ud_edge_perm][move] = get_ud_edge_perm(e_pos);
+    }
+  }
+
+  coord_tables_ready = true;
+}
+
+// 좌표 상태에 회전 번호 하나를 적용합니다. 좌표마다 표 조회 한 번입니다.
+inline void coord_move(CoordCube& coord, uint8_t move) {
+  coord.twist = twist_move_table[coord.twist][move];
+  coord.flip = flip_move_table[coord.flip][move];
+  coord.corner_perm = corner_perm_move_table[coord.corner_perm][move];
+  coord.edge4[0] = edge4_move_table[0][coord.edge4[0]][move];
+  coord.edge4[1] = edge4_move_table[1][coord.edge4[1]][move];
+  coord.edge4[2] = edge4_move_table[2][coord.edge4[2]][move];
+}
+
+#endif  // !COORD_CUBE_H
@@ -0,0 +1,171 @@
+#ifndef COORDINATES_H
+#define COORDINATES_H
+
+#include "VirtualCube.h"
+
+/* 좌표 계산 함수
+ *
+ * corner_pos/corner_ori/edge_pos/edge_ori 배열과 좌표(상태를 나타내는 정수) 사이의 변환 함수들입니다.
+ * 표를 사용하지 않으므로 장치에서도 그대로 쓸 수 있으며, CoordCube.h와 Thistlethwaite.h가 함께 사용합니다.
+ * 각 좌표의 의미는 CoordCube.h의 설명을 참고 바랍니다.
+ */
+constexpr uint16_t TWIST_COUNT = 2187;
+constexpr uint16_t FLIP_COUNT = 2048;
+constexpr uint16_t CORNER_PERM_COUNT = 40320;
+constexpr uint16_t EDGE4_COUNT = 11880;
+constexpr uint16_t SLICE_COUNT = 495;
+constexpr uint16_t UD_EDGE_PERM_COUNT = 40320;
+constexpr uint16_t COORD_INVALID = 0xFFFF;
+
+// edge4 좌표의 그룹 번호입니다. 그룹 g는 엣지 g * 4 ~ g * 4 + 3을 담당합니다.
+constexpr uint8_t EDGE_GROUP_U = 0;
+constexpr uint8_t EDGE_GROUP_SLICE = 1;
+constexpr uint8_t EDGE_GROUP_D = 2;
+
+// 가운데 층 엣지(4~7)가 제자리 층에 있을 때의 부분군(G1)에서 윗면/아랫면 엣지 8개가 놓이는 자리입니다.
+constexpr uint8_t ud_edge_positions[8] = { 0, 1, 2, 3, 8, 9, 10, 11 };
+
+// 가운데 층을 흐트러뜨리지 않는(G1 안에서 쓸 수 있는) 회전인지 확인합니다.
+inline bool is_g1_move(uint8_t move) {
+  return move_axis(move) <= static_cast<uint8_t>(Color::Y) || move_count(move) == 2;
+}
+
+/* 좌표 <-> 배열 변환
+ *
+ * set_*() 함수는 좌표가 담당하는 칸만 채우고 나머지 칸은 건드리지 않습니다.
+ */
+inline uint16_t choose(uint8_t n, uint8_t k) {
+  if (k > n) {
+    return 0;
+  }
+  uint16_t result = 1;
+  for (uint8_t i = 1; i <= k; ++i) {
+    result = result * (n - k + i) / i;
+  }
+  return result;
+}
+// 서로 다른 값 0..n-1로 이루어진 배열의 순열 번호(Lehmer code)를 구합니다. n은 8 이하입니다.
+inline uint16_t get_perm(const uint8_t* perm, uint8_t n) {
+  uint16_t rank = 0;
+  for (uint8_t i = 0; i < n; ++i) {
+    uint8_t smaller = 0;
+    for (uint8_t j = i + 1; j < n; ++j) {
+      smaller += perm[j] < perm[i];
+    }
+    rank = rank * (n - i) + smaller;
+  }
+  return rank;
+}
+inline void set_perm(uint8_t* perm, uint8_t n, uint16_t rank) {
+  uint8_t digits[8];
+  for (int i = n - 1; i >= 0; --i) {
+    digits[i] = rank % (n - i);
+    rank /= (n - i);
+  }
+  uint8_t used = 0;
+  for (uint8_t i = 0; i < n; ++i) {
+    uint8_t value = 0;
+    for (uint8_t skip = digits[i];; ++value) {
+      if (used & (1 << value)) {
+        continue;
+      }
+      if (skip-- == 0) {
+        break;
+      }
+    }
+    used |= 1 << value;
+    perm[i] = value;
+  }
+}
+
+inline uint16_t get_twist(const uint8_t c_ori[8]) {
+  uint16_t twist = 0;
+  for (int i = 0; i < 7; ++i) {
+    twist = twist * 3 + c_ori[i];
+  }
+  return twist;
+}
+inline void set_twist(uint8_t c_ori[8], uint16_t twist) {
+  uint8_t sum = 0;
+  for (int i = 6; i >= 0; --i) {
+    c_ori[i] = twist % 3;
+    sum += c_ori[i];
+    twist /= 3;
+  }
+  c_ori[7] = (3 - sum % 3) % 3;
+}
+
+inline uint16_t get_flip(const uint8_t e_ori[12]) {
+  uint16_t flip = 0;
+  for (int i = 0; i < 11; ++i) {
+    flip = flip * 2 + e_ori[i];
+  }
+  return flip;
+}
+inline void set_flip(uint8_t e_ori[12], uint16_t flip) {
+  uint8_t sum = 0;
+  for (int i = 10; i >= 0; --i) {
+    e_ori[i] = flip % 2;
+    sum += e_ori[i];
+    flip /= 2;
+  }
+  e_ori[11] = sum % 2;
+}
+
+inline uint16_t get_corner_perm(const uint8_t c_pos[8]) {
+  return get_perm(c_pos, 8);
+}
+inline void set_corner_perm(uint8_t c_pos[8], uint16_t corner_perm) {
+  set_perm(c_pos, 8, corner_perm);
+}
+
+// edge4 좌표를 계산할 때 자리를 훑는 순서입니다.
+// 그룹 밖의 자리를 먼저, 그룹의 제자리를 마지막에 두어서 맞춰진 상태가 0이 되게 합니다.
+inline uint8_t edge4_order(uint8_t group, uint8_t k) {
+  return k < 8 ? (k < group * 4 ? k : k + 4) : group * 4 + (k - 8);
+}
+inline uint16_t get_edge4(const uint8_t e_pos[12], uint8_t group) {
+  uint16_t combination = 0;
+  uint8_t perm[4];
+  uint8_t found = 0;
+  for (int k = 11; k >= 0; --k) {
+    uint8_t piece = e_pos[edge4_order(group, k)] - group * 4;
+    if (piece < 4) {
+      combination += choose(11 - k, found + 1);
+      perm[3 - found] = piece;
+      found++;
+    }
+  }
+  return combination * 24 + get_perm(perm, 4);
+}
+inline void set_edge4(uint8_t e_pos[12], uint8_t group, uint16_t edge4) {
+  uint16_t combination = edge4 / 24;
+  uint8_t perm[4];
+  set_perm(perm, 4, edge4 % 24);
+  uint8_t left = 4;
+  for (uint8_t k = 0; k < 12 && left > 0; ++k) {
+    if (combination >= choose(11 - k, left)) {
+      combination -= choose(11 - k, left);
+      e_pos[edge4_order(group, k)] = group * 4 + perm[4 - left];
+      left--;
+    }
+  }
+}
+
+// G1에서만 의미가 있는 좌표로, 윗면/아랫면 엣지 8개의 순서입니다.
+inline uint16_t get_ud_edge_perm(const uint8_t e_pos[12]) {
+  uint8_t perm[8];
+  for (int i = 0; i < 8; ++i) {
+    perm[i] = e_pos[ud_edge_positions[i]] < 4 ? e_pos[ud_edge_positions[i]] : e_pos[ud_edge_positions[i]] - 4;
+  }
+  return get_perm(perm, 8);
+}
+inline void set_ud_edge_perm(uint8_t e_pos[12], uint16_t ud_edge_perm) {
+  uint8_t perm[8];
+  set_perm(perm, 8, ud_edge_perm);
+  for (int i = 0; i < 8; ++i) {
+    e_pos[ud_edge_positions[i]] = ud_edge_positions[perm[i]];
+  }
+}
+
+#endif  // !COORDINATES_H
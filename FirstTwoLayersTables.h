@@ -0,0 +1,53 @@
+#ifndef FIRST_TWO_LAYERS_TABLES_H
+#define FIRST_TWO_LAYERS_TABLES_H
+
+// host/first_two_layers_gen.cpp가 만든 파일입니다. 직접 고치지 말고 생성기를 다시 실행하세요.
+// 매크로 번호와 경우 번호의 형식은 VirtualCube.h의 "두 층 표"를 참고하세요.
+
+constexpr uint8_t FIRST_TWO_LAYERS_STEPS = 5;
+
+// 칸 s의 코너가 자리 p에 방향 o로 있을 때 [s * 24 + p * 3 + o] -> 칸 0의 코너 경우(0..23)
+const uint8_t first_two_layers_corner_case[96] PROGMEM = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 9, 10, 11, 0, 1, 2, 3, 4,
+  5, 6, 7, 8, 21, 22, 23, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+  6, 7, 8, 9, 10, 11, 0, 1, 2, 3, 4, 5, 18, 19, 20, 21,
+  22, 23, 12, 13, 14, 15, 16, 17, 3, 4, 5, 6, 7, 8, 9, 10,
+  11, 0, 1, 2, 15, 16, 17, 18, 19, 20, 21, 22, 23, 12, 13, 14,
+};
+// 칸 s의 엣지가 자리 p(4..11)에 방향 o로 있을 때 [s * 16 + (p - 4) * 2 + o] -> 칸 0의 엣지 경우(0..15)
+const uint8_t first_two_layers_edge_case[64] PROGMEM = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  6, 7, 0, 1, 2, 3, 4, 5, 15, 14, 9, 8, 11, 10, 13, 12,
+  4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9, 10, 11,
+  2, 3, 4, 5, 6, 7, 0, 1, 11, 10, 13, 12, 15, 14, 9, 8,
+};
+// 2단계: 코너 경우 * 16 + 엣지 경우 -> 다음 매크로
+const uint8_t first_two_layers_table[384] PROGMEM = {
+  255, 3, 12, 5, 3, 5, 3, 4, 0, 4, 13, 0, 0, 3, 12, 0,
+  3, 12, 3, 11, 16, 4, 3, 5, 13, 2, 2, 1, 1, 0, 0, 5,
+  3, 5, 3, 4, 25, 12, 7, 6, 1, 0, 0, 4, 12, 2, 2, 1,
+  3, 14, 10, 9, 16, 20, 18, 9, 18, 0, 2, 10, 1, 0, 0, 9,
+  3, 4, 11, 9, 11, 9, 6, 7, 0, 1, 11, 0, 2, 20, 1, 2,
+  12, 4, 11, 10, 10, 9, 19, 7, 10, 1, 9, 0, 0, 9, 18, 2,
+  3, 4, 9, 10, 15, 15, 6, 7, 0, 17, 24, 0, 0, 16, 25, 0,
+  4, 12, 11, 9, 16, 24, 7, 17, 1, 25, 0, 2, 17, 1, 2, 0,
+  3, 5, 10, 16, 15, 17, 6, 8, 0, 2, 16, 1, 2, 0, 1, 15,
+  4, 3, 21, 8, 22, 17, 6, 8, 7, 0, 0, 21, 6, 2, 0, 1,
+  5, 6, 18, 10, 7, 6, 6, 6, 2, 8, 1, 7, 0, 23, 7, 0,
+  5, 7, 6, 10, 6, 8, 6, 6, 2, 6, 1, 2, 0, 1, 21, 0,
+  3, 5, 0, 5, 4, 1, 2, 12, 4, 14, 3, 13, 1, 2, 0, 1,
+  0, 0, 2, 10, 2, 26, 8, 6, 2, 5, 0, 1, 0, 0, 3, 0,
+  0, 1, 9, 11, 0, 15, 0, 7, 0, 2, 12, 0, 2, 14, 2, 0,
+  5, 4, 10, 0, 4, 0, 1, 4, 4, 0, 2, 1, 14, 2, 0, 1,
+  3, 14, 1, 0, 1, 2, 2, 0, 2, 13, 1, 2, 13, 0, 12, 14,
+  13, 0, 2, 0, 17, 2, 21, 0, 1, 3, 5, 1, 2, 12, 1, 2,
+  3, 0, 2, 14, 3, 16, 0, 3, 14, 0, 2, 3, 1, 0, 1, 1,
+  0, 12, 0, 18, 0, 1, 1, 22, 5, 2, 1, 2, 0, 1, 2, 13,
+  0, 3, 1, 19, 2, 1, 2, 23, 0, 1, 0, 12, 4, 0, 1, 2,
+  3, 13, 1, 11, 13, 2, 6, 0, 0, 0, 2, 13, 1, 2, 0, 3,
+  4, 1, 18, 0, 15, 0, 0, 0, 1, 12, 3, 1, 0, 1, 5, 0,
+  5, 3, 0, 0, 1, 0, 1, 0, 0, 1, 4, 0, 3, 5, 1, 4,
+};
+
+#endif  // !FIRST_TWO_LAYERS_TABLES_H
@@ -0,0 +1,91 @@
+#ifndef LAST_LAYER_TABLES_H
+#define LAST_LAYER_TABLES_H
+
+// host/last_layer_gen.cpp가 만든 파일입니다. 직접 고치지 말고 생성기를 다시 실행하세요.
+// 알고리즘은 회전 번호(axis * 3 + count - 1)이며, 칸 값의 형식은 VirtualCube.h의 "마지막 층 표"를 참고하세요.
+//
+//    0 OLL 45 (line)        F R U R' U' F'
+//    1 OLL 44 (L)           F U R U' R' F'
+//    2 OLL 27 (sune)        R U R' U R U2 R'
+//    3 OLL 26 (anti-sune)   R U2 R' U' R U' R'
+//    4 OLL 21 (H)           F R U R' U' R U R' U' R U R' U' F'
+//    5 OLL 22 (pi)          R U2 R2 U' R2 U' R2 U2 R
+//    6 OLL 23 (headlights)  R2 D R' U2 R D' R' U2 R'
+//    7 OLL 24 (chameleon)   L F R' F' L' F R F'
+//    8 OLL 25 (bowtie)      F' L F R' F' L' F R
+//    9 T                    R U R' U' R' F R2 U' R' U' R U R' F'
+//   10 Ua                   R U' R U R U R U' R' U' R2
+//   11 Ub                   R2 U R U R' U' R' U' R' U R'
+//   12 H                    R2 U2 R U2 R2 U2 R2 U2 R U2 R2
+//   13 Aa                   R' F R' B2 R F' R' B2 R2
+//   14 Ab                   R2 B2 R F R' B2 R F' R
+//   15 Ja                   R' U L' U2 R U' R' U2 R L U'
+//   16 Jb                   R U R' F' R U R' U' R' F R2 U' R' U'
+//   17 Y                    F R U' R' U' R U R' F' R U R' U' R' F R F'
+//   18 F                    R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R
+
+constexpr uint8_t LAST_LAYER_PERMUTATION_FIRST = 9;
+constexpr uint8_t LAST_LAYER_ORIENTATION_STEPS = 3;
+constexpr uint8_t LAST_LAYER_PERMUTATION_STEPS = 2;
+
+// 알고리즘의 회전 번호를 이어 붙인 것
+const uint8_t last_layer_moves[199] PROGMEM = {
+  6, 12, 3, 14, 5, 8, 6, 3, 12, 5, 14, 8, 12, 3, 14, 3,
+  12, 4, 14, 12, 4, 14, 5, 12, 5, 14, 6, 12, 3, 14, 5, 12,
+  3, 14, 5, 12, 3, 14, 5, 8, 12, 4, 13, 5, 13, 5, 13, 4,
+  12, 13, 0, 14, 4, 12, 2, 14, 4, 14, 15, 6, 14, 8, 17, 6,
+  12, 8, 8, 15, 6, 14, 8, 17, 6, 12, 12, 3, 14, 5, 14, 6,
+  13, 5, 14, 5, 12, 3, 14, 8, 12, 5, 12, 3, 12, 3, 12, 5,
+  14, 5, 13, 13, 3, 12, 3, 14, 5, 14, 5, 14, 3, 14, 13, 4,
+  12, 4, 13, 4, 13, 4, 12, 4, 13, 14, 6, 14, 10, 12, 8, 14,
+  10, 13, 13, 10, 12, 6, 14, 10, 12, 8, 12, 14, 3, 17, 4, 12,
+  5, 14, 4, 12, 15, 5, 12, 3, 14, 8, 12, 3, 14, 5, 14, 6,
+  13, 5, 14, 5, 6, 12, 5, 14, 5, 12, 3, 14, 8, 12, 3, 14,
+  5, 14, 6, 12, 8, 14, 5, 8, 12, 3, 14, 5, 14, 6, 13, 5,
+  14, 5, 12, 3, 14, 3, 12,
+};
+// 알고리즘 i는 last_layer_moves[begin[i]..begin[i + 1])
+const uint8_t last_layer_begin[20] PROGMEM = {
+  0, 6, 12, 19, 26, 40, 49, 58, 66, 74, 88, 99, 110, 121, 130, 139,
+  150, 164, 181, 199,
+};
+// 3단계: 방향 칸 -> 다음 칸 값
+const uint8_t last_layer_orientation_table[216] PROGMEM = {
+  255, 28, 32, 24, 16, 36, 20, 32, 136, 44, 20, 20, 32, 24, 36, 20,
+  124, 44, 20, 40, 32, 24, 36, 16, 144, 44, 20, 48, 32, 24, 36, 32,
+  72, 24, 20, 40, 24, 16, 36, 32, 132, 44, 20, 40, 32, 16, 16, 16,
+  152, 44, 28, 40, 56, 16, 36, 36, 120, 44, 20, 40, 32, 16, 36, 20,
+  48, 20, 28, 40, 20, 24, 36, 44, 112, 44, 28, 40, 32, 16, 36, 20,
+  76, 44, 20, 40, 28, 24, 28, 36, 156, 44, 20, 40, 32, 16, 60, 40,
+  64, 44, 28, 16, 32, 24, 16, 40, 68, 20, 28, 20, 32, 16, 36, 44,
+  108, 28, 36, 40, 32, 16, 64, 28, 128, 44, 20, 40, 20, 16, 36, 20,
+  80, 44, 20, 40, 32, 16, 36, 16, 104, 44, 20, 24, 76, 32, 36, 24,
+  140, 16, 28, 40, 32, 16, 36, 16, 148, 52, 28, 40, 32, 24, 36, 32,
+  52, 44, 28, 40, 24, 16, 24, 32, 116, 44, 20, 40, 32, 16, 36, 16,
+  96, 44, 20, 68, 16, 40, 36, 16, 84, 44, 20, 40, 32, 16, 36, 20,
+  56, 44, 20, 28, 32, 16, 28, 36, 100, 72, 44, 40, 32, 16, 20, 20,
+  60, 16, 20, 16, 32, 24, 36, 40,
+};
+// 4단계: 위치 칸 -> 다음 칸 값
+const uint8_t last_layer_permutation_table[288] PROGMEM = {
+  255, 56, 40, 32, 52, 48, 36, 60, 64, 32, 44, 32, 116, 80, 16, 40,
+  109, 35, 43, 160, 32, 91, 128, 39, 140, 112, 172, 92, 105, 35, 43, 28,
+  32, 87, 36, 39, 80, 125, 40, 169, 52, 48, 36, 137, 102, 32, 44, 25,
+  96, 56, 123, 167, 52, 48, 36, 60, 94, 32, 135, 23, 80, 144, 16, 88,
+  80, 84, 86, 20, 158, 80, 152, 150, 32, 136, 24, 124, 101, 35, 43, 168,
+  32, 83, 88, 39, 80, 157, 155, 116, 80, 149, 83, 88, 80, 147, 91, 16,
+  92, 133, 40, 21, 121, 48, 36, 60, 98, 32, 44, 165, 37, 33, 16, 45,
+  1, 61, 53, 20, 57, 65, 41, 49, 92, 33, 30, 96, 85, 114, 43, 174,
+  32, 107, 36, 142, 88, 56, 40, 161, 129, 117, 36, 60, 110, 32, 44, 17,
+  108, 56, 131, 19, 52, 48, 119, 60, 90, 32, 44, 163, 104, 33, 22, 84,
+  93, 35, 122, 166, 134, 99, 36, 39, 148, 92, 16, 156, 80, 146, 154, 20,
+  80, 80, 84, 82, 84, 56, 40, 29, 52, 141, 36, 113, 106, 32, 44, 173,
+  66, 46, 54, 32, 42, 38, 50, 34, 2, 62, 58, 32, 32, 88, 170, 40,
+  81, 138, 43, 26, 126, 103, 108, 39, 51, 63, 16, 59, 67, 35, 43, 20,
+  47, 3, 55, 39, 104, 56, 40, 175, 52, 48, 143, 60, 86, 115, 44, 31,
+  100, 56, 40, 27, 52, 48, 36, 60, 82, 139, 127, 171, 84, 33, 164, 132,
+  97, 35, 43, 20, 32, 95, 120, 39, 32, 100, 162, 40, 89, 35, 130, 18,
+  32, 111, 80, 118, 80, 84, 87, 16, 153, 81, 151, 145, 80, 80, 159, 112,
+};
+
+#endif  // !LAST_LAYER_TABLES_H
@@ -0,0 +1,69 @@
+#ifndef MOVE_BUFFER_H
+#define MOVE_BUFFER_H
+
+/* 회전 기록용 고정 크기 버퍼
+ *
+ * rotate()가 기록하는 회전과 solve()가 만드는 해법을 저장합니다.
+ * 회전 하나는 VirtualCube의 알파벳 한 글자(1바이트)로 저장되며, 대문자는 시계방향, 소문자는 반시계방향,
+ * 숫자(축 번호)는 180도 회전입니다.
+ * 2KB SRAM에서 String이 한 글자씩 늘어나며 힙을 재할당하고 조각내는 것을 막기 위해
+ * 처음부터 MOVE_BUFFER_CAPACITY 크기의 배열을 잡아두고 사용합니다.
+ *
+ * 가득 찬 뒤에 추가되는 회전은 버려지고 overflowed()가 true가 됩니다.
+ * solve()는 정리 단계 전까지 쿼터 턴을 하나씩 기록하므로, 기본 크기는 그 최대 기록 길이에 여유를 더한 값입니다.
+ * host/explore_solve가 찾은 최악의 상태는 186회이고, 호스트 벤치마크(100만 개의 스크램블)의 1~4단계별 최댓값을 더해도 216회입니다.
+ * Thistlethwaite(45회 이하)와 호스트가 보내는 답은 이보다 짧습니다. 해법의 단계를 바꾸면 explore_solve로 다시 확인하세요.
+ */
+#ifndef MOVE_BUFFER_CAPACITY
+#define MOVE_BUFFER_CAPACITY 256
+#endif
+
+struct MoveBuffer {
+  char moves[MOVE_BUFFER_CAPACITY];
+  uint16_t size = 0;
+  bool overflow = false;
+
+  // 기록을 모두 지웁니다. 배열 자체는 그대로 재사용합니다.
+  void clear() {
+    size = 0;
+    overflow = false;
+  }
+  // 회전 하나를 뒤에 추가합니다. 버퍼가 가득 찼으면 false를 반환합니다.
+  bool append(char move) {
+    if (size >= MOVE_BUFFER_CAPACITY) {
+      overflow = true;
+      return false;
+    }
+    moves[size++] = move;
+    return true;
+  }
+
+  uint16_t length() const {
+    return size;
+  }
+  bool overflowed() const {
+    return overflow;
+  }
+  char& operator[](uint16_t index) {
+    return moves[index];
+  }
+  char operator[](uint16_t index) const {
+    return moves[index];
+  }
+
+  // 범위 기반 for문으로 기록된 순서대로 순회할 수 있습니다.
+  char* begin() {
+    return moves;
+  }
+  char* end() {
+    return moves + size;
+  }
+  const char* begin() const {
+    return moves;
+  }
+  const char* end() const {
+    return moves + size;
+  }
+};
+
+#endif  // !MOVE_BUFFER_H
@@ -0,0 +1,209 @@
+#ifndef OFFLOAD_H
+#define OFFLOAD_H
+
+#include "VirtualCube.h"
+
+/* 해법 맡기기(offload)
+ *
+ * 장치에는 큰 표를 둘 곳이 없으므로, Serial로 연결된 호스트(host/offload_server.cpp)에 상태를 보내 해법을 받습니다.
+ *
+ * 요청(장치 -> 호스트, 43바이트)
+ *   OFFLOAD_REQUEST_SYNC, 번호, 상태 40바이트, CRC-8(번호와 상태)
+ *   상태는 CubeState::unpack()의 배열을 c_pos[8], c_ori[8], e_pos[12], e_ori[12] 순서로 씁니다.
+ *   번호는 요청마다 1씩 늘어나며, 답에 같은 번호가 붙어 있어야 받습니다(버린 요청의 늦은 답을 거릅니다).
+ *
+ * 답(호스트 -> 장치): OFFLOAD_RESPONSE_SYNC, 번호, 회전마다 4비트(한 바이트의 아래 4비트가 먼저)
+ *   0..11  축 * 2 + (반시계면 1)의 90도 회전
+ *   12     바로 앞 90도 회전을 한 번 더(180도 회전은 두 칸, 1바이트)
+ *   15     해법의 끝. 아래 4비트에서 끝나면 위 4비트도 15로 채웁니다.
+ *   13, 14는 쓰지 않으며 받으면 끝으로 처리합니다.
+ * 답에는 체크섬이 없습니다. 받는 대로 가상 큐브에 적용해서 수행하고, 끝에서 가상 큐브가 맞춰졌는지로 확인합니다.
+ * 가상 큐브는 수행한 회전을 그대로 따라가므로 답이 깨져도 맞지 않을 뿐이고, 그 상태에서 다시 풀면 됩니다.
+ *
+ * 호스트가 OFFLOAD_TIMEOUT_MS 안에 답을 시작하지 않거나 답이 도중에 그만큼 끊기면 offload_expired()가 참이 되고,
+ * PhysicalCube.h는 solve()로 대신합니다. 115200bps에서 요청은 약 3.7ms, 20회 안팎의 답은 약 1.5ms입니다.
+ */
+#ifndef OFFLOAD_BAUD
+#define OFFLOAD_BAUD 115200
+#endif
+#ifndef OFFLOAD_TIMEOUT_MS
+#define OFFLOAD_TIMEOUT_MS 1000
+#endif
+
+constexpr uint8_t OFFLOAD_REQUEST_SYNC = 0xC5;
+constexpr uint8_t OFFLOAD_RESPONSE_SYNC = 0x5C;
+constexpr uint8_t OFFLOAD_STATE_SIZE = 40;
+constexpr uint8_t OFFLOAD_REQUEST_SIZE = OFFLOAD_STATE_SIZE + 3;
+constexpr uint8_t OFFLOAD_REPEAT = 12;
+constexpr uint8_t OFFLOAD_END = 15;
+constexpr uint8_t OFFLOAD_NONE = 0xFF;
+
+/* 1. 형식
+ *
+ * 장치와 호스트가 함께 쓰는 부분입니다.
+ */
+inline uint8_t offload_crc8(const uint8_t* data, uint8_t size) {  // 다항식 0x07
+  uint8_t crc = 0;
+  for (uint8_t i = 0; i < size; ++i) {
+    crc ^= data[i];
+    for (uint8_t bit = 0; bit < 8; ++bit) {
+      crc = crc & 0x80 ? (crc << 1) ^ 0x07 : crc << 1;
+    }
+  }
+  return crc;
+}
+// 40바이트 상태가 실제로 만들 수 있는 상태인지 확인합니다.
+// 조각이 한 번씩만 나오고, 비틀림 합이 3의 배수, 뒤집힘 합이 짝수, 코너와 엣지의 순열 홀짝이 같아야 합니다.
+inline bool offload_state_valid(const uint8_t* state) {
+  const uint8_t* c_pos = state;
+  const uint8_t* c_ori = state + 8;
+  const uint8_t* e_pos = state + 16;
+  const uint8_t* e_ori = state + 28;
+  uint16_t c_seen = 0, e_seen = 0;
+  uint8_t twist = 0, flip = 0, parity = 0;
+  for (uint8_t i = 0; i < 8; ++i) {
+    if (c_pos[i] >= 8 || c_ori[i] >= 3 || (c_seen >> c_pos[i] & 1)) {
+      return false;
+    }
+    c_seen |= 1 << c_pos[i];
+    twist += c_ori[i];
+    for (uint8_t j = 0; j < i; ++j) {
+      parity ^= c_pos[j] > c_pos[i];
+    }
+  }
+  for (uint8_t i = 0; i < 12; ++i) {
+    if (e_pos[i] >= 12 || e_ori[i] >= 2 || (e_seen >> e_pos[i] & 1)) {
+      return false;
+    }
+    e_seen |= 1 << e_pos[i];
+    flip += e_ori[i];
+    for (uint8_t j = 0; j < i; ++j) {
+      parity ^= e_pos[j] > e_pos[i];
+    }
+  }
+  return twist % 3 == 0 && flip % 2 == 0 && parity == 0;
+}
+inline void offload_write_state(const CubeState& state, uint8_t* out) {
+  state.unpack(out, out + 8, out + 16, out + 28);
+}
+inline CubeState offload_read_state(const uint8_t* in) {
+  return CubeState::pack(in, in + 8, in + 16, in + 28);
+}
+// 해법 알파벳을 답의 4비트 회전열로 바꿔 out에 쓰고 바이트 수를 반환합니다. out은 length + 1바이트면 충분합니다.
+inline uint16_t offload_encode(const char* solution, uint16_t length, uint8_t* out) {
+  uint16_t nibbles = 0;
+  auto push = [&](uint8_t code) {
+    if (nibbles % 2 == 0) {
+      out[nibbles / 2] = code;
+    } else {
+      out[nibbles / 2] |= code << 4;
+    }
+    nibbles++;
+  };
+  for (uint16_t i = 0; i < length; ++i) {
+    uint8_t axis, count;
+    if (parse_move_char(solution[i], axis, count)) {
+      push(axis * 2 + (count == 3));
+      if (count == 2) {
+        push(OFFLOAD_REPEAT);
+      }
+    }
+  }
+  push(OFFLOAD_END);
+  if (nibbles % 2 != 0) {
+    push(OFFLOAD_END);
+  }
+  return nibbles / 2;
+}
+
+/* 2. 장치
+ *
+ * offload_request()로 cube를 보내고, 매 루프 offload_receive()로 받은 만큼 append_move()와 함께 cube에 적용합니다.
+ * 180도 회전이 두 칸에 걸쳐 오므로 90도 회전은 다음 칸을 받을 때까지 offload_held에 잡아 둡니다.
+ */
+enum class OffloadState : uint8_t {
+  IDLE,      // 요청이 없습니다. 받은 바이트는 버립니다.
+  SYNC,      // 답의 시작을 기다립니다.
+  SEQUENCE,  // 답의 번호를 기다립니다.
+  MOVES,     // 회전을 받는 중입니다.
+};
+OffloadState offload_state = OffloadState::IDLE;
+uint8_t offload_sequence = 0;
+uint8_t offload_held = OFFLOAD_NONE;
+uint32_t offload_last_ms;  // 요청을 보냈거나 마지막으로 답을 받은 시간입니다.
+
+inline void offload_request() {
+  while (Serial.available() > 0) {  // 앞선 요청의 남은 답을 버립니다.
+    Serial.read();
+  }
+  uint8_t frame[OFFLOAD_REQUEST_SIZE];
+  frame[0] = OFFLOAD_REQUEST_SYNC;
+  frame[1] = ++offload_sequence;
+  offload_write_state(cube, frame + 2);
+  frame[OFFLOAD_REQUEST_SIZE - 1] = offload_crc8(frame + 1, OFFLOAD_STATE_SIZE + 1);
+  Serial.write(frame, sizeof(frame));  // AVR의 송신 버퍼(64바이트) 안에 들어가므로 기다리지 않습니다.
+  offload_state = OffloadState::SYNC;
+  offload_held = OFFLOAD_NONE;
+  offload_last_ms = millis();
+}
+inline void offload_cancel() {
+  offload_state = OffloadState::IDLE;
+  offload_held = OFFLOAD_NONE;
+}
+inline bool offload_expired() {
+  return offload_state != OffloadState::IDLE && millis() - offload_last_ms >= OFFLOAD_TIMEOUT_MS;
+}
+inline void offload_apply(uint8_t move) {
+  append_move(container, move);
+  turn_cube_move(cube, move);
+}
+// 4비트 하나를 처리합니다. 해법이 끝났으면 true를 반환합니다.
+inline bool offload_nibble(uint8_t code) {
+  if (code == OFFLOAD_REPEAT && offload_held != OFFLOAD_NONE) {
+    offload_apply(offload_held / 2 * 3 + 1);
+    offload_held = OFFLOAD_NONE;
+    return false;
+  }
+  if (offload_held != OFFLOAD_NONE) {
+    offload_apply(offload_held / 2 * 3 + offload_held % 2 * 2);
+    offload_held = OFFLOAD_NONE;
+  }
+  if (code < OFFLOAD_REPEAT) {
+    offload_held = code;
+    return false;
+  }
+  return true;
+}
+// 받은 바이트를 모두 처리합니다. 해법의 끝을 받았으면 IDLE로 돌아가고 true를 반환합니다.
+inline bool offload_receive() {
+  while (Serial.available() > 0) {
+    uint8_t value = Serial.read();
+    switch (offload_state) {
+      case OffloadState::IDLE:
+        break;
+      case OffloadState::SYNC:
+        if (value == OFFLOAD_RESPONSE_SYNC) {
+          offload_state = OffloadState::SEQUENCE;
+        }
+        break;
+      case OffloadState::SEQUENCE:
+        if (value == offload_sequence) {
+          offload_state = OffloadState::MOVES;
+          offload_last_ms = millis();
+        } else if (value != OFFLOAD_RESPONSE_SYNC) {
+          offload_state = OffloadState::SYNC;
+        }
+        break;
+      case OffloadState::MOVES:
+        offload_last_ms = millis();
+        if (offload_nibble(value & 0x0F) || offload_nibble(value >> 4)) {
+          offload_cancel();
+          return true;
+        }
+        break;
+    }
+  }
+  return false;
+}
+
+#endif  // !OFFLOAD_H
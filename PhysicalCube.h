@@ -3,12 +3,26 @@
 
 #include "VirtualCube.h"
 
+// 해법 종류입니다. 스케치에서 이 파일보다 먼저 CUBE_SOLVER를 정의해서 고를 수 있습니다.
+#define CUBE_SOLVER_LBL 0             // VirtualCube.h의 solve(): 층별 해법
+#define CUBE_SOLVER_THISTLETHWAITE 1  // Thistlethwaite.h의 thistlethwaite_solve(): 45회 이하, 표 약 12KB(PROGMEM)
+#define CUBE_SOLVER_OFFLOAD 2         // Offload.h: Serial로 연결된 호스트가 구한 해법, 답이 없으면 solve()
+#ifndef CUBE_SOLVER
+#define CUBE_SOLVER CUBE_SOLVER_LBL
+#endif
+#if CUBE_SOLVER == CUBE_SOLVER_THISTLETHWAITE
+#include "Thistlethwaite.h"
+#elif CUBE_SOLVER == CUBE_SOLVER_OFFLOAD
+#include "Offload.h"
+#endif
+#include "Telemetry.h"
+
 constexpr int MOTOR_DRIVER_IN1[6] = { 3, 5, 6, 9, 10, 11 };  // IN_1 핀들은 PWM 핀. 즉, 아날로그 출력을 담당합니다
 constexpr int MOTOR_DRIVER_IN2[6] = { 2, 4, 7, 8, 12, 13 };  // IN_2 핀들은 일반 디지털 핀으로 디지털 출력을 담당합니다.
 constexpr int SENSOR_OUT[6] = { A0, A1, A2, A3, A4, A5 };    // 디지털 핀을 모두 사용해서 아날로그 핀이 디지털 입력을 담당합니다.
-// 아래 두 배열에 센서로 측정한 모터의 회전 수치를 저장합니다.
-int axis_old_rotation[6] = {};  // 축을 인덱스로 직전 프레임의 각 면의 회전 수치를 저장합니다.
-int axis_now_rotation[6] = {};  // 축을 인덱스로 현재 프레임의 각 면의 회전 수치를 저장합니다.
+// 아래 두 배열에 센서로 측정한 모터의 회전 수치(풀어 쓴 누적값, sensor_position 참고)를 저장합니다.
+int32_t axis_old_rotation[6] = {};  // 축을 인덱스로 직전 프레임의 각 면의 회전 수치를 저장합니다.
+int32_t axis_now_rotation[6] = {};  // 축을 인덱스로 현재 프레임의 각 면의 회전 수치를 저장합니다.
 // 마지막으로 회전을 감지한 시간을 저장합니다.
 // 이를 계산하기 위해 axis_old_rotation를 정의하고 사용합니다.
 uint32_t last_rotated;
@@ -38,22 +52,275 @@ void motor_rotate_ccw(int axis, int speed) {  // 모터를 반시계방향으로
   analogWrite(MOTOR_DRIVER_IN1[axis], speed2);
   digitalWrite(MOTOR_DRIVER_IN2[axis], HIGH);
 }
-void motor_write(int axis, int target_rotate) {  // 목표 회전값까지 회전하도록 하는 함수입니다.
-  for (int delta_rotate = (target_rotate - sensor_read(axis) + 1024) % 1024;
-       !(-3 <= delta_rotate && delta_rotate <= 3);
-       delta_rotate = (target_rotate - sensor_read(axis) + 1024) % 1024) {
-    if (/*0 <= delta_rotate &&*/ delta_rotate < 512) {
-      motor_rotate_cw(axis, 50);
-    } else {
-      motor_rotate_ccw(axis, 50);
-    }
-  }
+void motor_stop(int axis) {  // 모터를 멈추는 함수입니다.
+  analogWrite(MOTOR_DRIVER_IN1[axis], 0);
+  digitalWrite(MOTOR_DRIVER_IN2[axis], LOW);
 }
 
 // 큐브의 회전값을 받아서 그 방향을 0, 1, 2, 3의 숫자 중 하나로 반환합니다.
 // 큐브는 물리적으로 하나의 면이 완전히 맞닿은 직각으로 회전해야 다른 면이 회전할 수 있으므로 다른 면의 회전은 확인하지 않습니다.
-int get_cube_area(int rotation) {
-  return (rotation + 128) / 256 /*% 4*/;  // 원래라면 "% 4"를 붙이는 게 맞지만, 그 사용 과정에 "% 4"가 포함되어 있기 때문에 생략합니다.
+// 누적 회전값은 음수이거나 1024를 넘을 수 있으므로 내림으로 나눕니다.
+int32_t get_cube_area(int32_t rotation) {
+  int32_t shifted = rotation + 128;
+  return shifted >= 0 ? shifted / 256 : -((255 - shifted) / 256) /*% 4*/;  // 원래라면 "% 4"를 붙이는 게 맞지만, 그 사용 과정에 "% 4"가 포함되어 있기 때문에 생략합니다.
+}
+
+/* 센서 샘플링
+ *
+ * 여섯 축의 센서를 한 번에 읽어 풀어 쓴 누적 회전값(sensor_total)으로 쌓아 두고,
+ * 메인 루프는 sensor_refresh()로 그 스냅숏을 sensor_position에 복사해서 씁니다.
+ * 누적값은 샘플 사이의 변화가 반 바퀴(512)보다 작기만 하면 90도 회전을 잃지 않으므로,
+ * 빠르게 돌린 면이 루프 사이에 두 칸을 넘어가도 방향을 잘못 읽지 않습니다.
+ *
+ * ATmega328P에서는 A0~A5가 모두 PORTC(PC0~PC5)이므로 PINC 한 번으로 여섯 축을 읽고,
+ * 핀 변화 인터럽트(PCINT1)가 올 때마다 샘플링해서 메인 루프의 주기와 상관없이 변화를 놓치지 않습니다.
+ * 읽는 쪽은 잠그지 않습니다. 인터럽트는 쓰는 동안 sensor_sequence를 홀수로 두고, 읽는 쪽은 복사하는 사이에 바뀌었으면 다시 읽습니다.
+ * 다른 보드와 호스트(또는 SENSOR_POLLING을 정의한 경우)에서는 sensor_refresh()가 먼저 sensor_read()로 직접 샘플링합니다.
+ */
+#if defined(__AVR_ATmega328P__) && !defined(SENSOR_POLLING)
+#define SENSOR_INTERRUPT 1
+#else
+#define SENSOR_INTERRUPT 0
+#endif
+volatile uint8_t sensor_sequence = 0;
+volatile int16_t sensor_last[6] = {};   // 마지막 샘플의 센서값 [0,1024)입니다.
+volatile int32_t sensor_total[6] = {};  // 풀어 쓴 누적 회전값입니다. 인터럽트만 씁니다.
+int32_t sensor_position[6] = {};        // 메인 루프가 쓰는 sensor_total의 스냅숏입니다.
+
+void sensor_read_all(int16_t values[6]) {  // 여섯 축의 센서를 한 번에 읽습니다.
+#if SENSOR_INTERRUPT
+  uint8_t port = PINC;  // digitalRead(A0~A5)와 같은 값입니다.
+  for (int axis = 0; axis < 6; ++axis) {
+    values[axis] = port >> axis & 1;
+  }
+#else
+  for (int axis = 0; axis < 6; ++axis) {
+    values[axis] = sensor_read(axis);
+  }
+#endif
+}
+void sensor_sample() {  // 여섯 축을 샘플링해서 누적 회전값에 더합니다.
+  int16_t values[6];
+  sensor_read_all(values);
+  sensor_sequence++;
+  for (int axis = 0; axis < 6; ++axis) {
+    sensor_total[axis] += (values[axis] - sensor_last[axis] + 1024 + 512) % 1024 - 512;
+    sensor_last[axis] = values[axis];
+  }
+  sensor_sequence++;
+}
+void sensor_refresh() {  // 최신 누적 회전값을 sensor_position에 복사합니다.
+#if !SENSOR_INTERRUPT
+  sensor_sample();
+#endif
+  uint8_t sequence;
+  do {
+    sequence = sensor_sequence;
+    for (int axis = 0; axis < 6; ++axis) {
+      sensor_position[axis] = sensor_total[axis];
+    }
+  } while ((sequence & 1) != 0 || sequence != sensor_sequence);
+}
+void sensor_begin() {  // 누적 회전값을 지금 센서값으로 맞추고 샘플링을 시작합니다.
+  int16_t values[6];
+  sensor_read_all(values);
+  for (int axis = 0; axis < 6; ++axis) {
+    sensor_last[axis] = values[axis];
+    sensor_total[axis] = values[axis];
+  }
+#if SENSOR_INTERRUPT
+  PCMSK1 |= 0x3F;            // PCINT8~13 = A0~A5
+  PCIFR = bit(PCIF1);        // 설정 전에 쌓인 변화는 버립니다.
+  PCICR |= bit(PCIE1);
+#endif
+  sensor_refresh();
+}
+#if SENSOR_INTERRUPT
+ISR(PCINT1_vect) {
+  sensor_sample();
+}
+#endif
+
+/* 축별 모터 상태와 위치 제어
+ *
+ * 각 축은 상태(state)와 완료 표시(done), 위치 제어에 필요한 값들을 가집니다.
+ * motor_update()는 기다리지 않고 움직이는 축을 한 번씩만 확인해서 PWM을 정하거나 멈추므로,
+ * cube_update()가 매 루프마다 부르면 여러 축이 동시에 돌고 그 사이에 센서 추적 등 다른 일도 할 수 있습니다.
+ *   MOVING   목표에서 MOTOR_OVERLAP_WINDOW보다 멀리 있습니다.
+ *   SETTLING 목표 근처(약 8도 이내)라서 옆면이 걸리지 않으며, 허용 오차(MOTOR_TOLERANCE) 안으로 들어가는 중입니다.
+ *   IDLE     멈춰 있습니다. 허용 오차 안에 MOTOR_SETTLE_US 동안 머물러 멈출 때 done이 true가 됩니다.
+ *
+ * 위치는 sensor_position(풀어 쓴 누적 회전값)을 쓰므로, motor_update() 전에 sensor_refresh()를 불러야 합니다.
+ * 회전을 시작하면 기준 위치가 사다리꼴 속도 프로필(가속 MOTOR_ACCEL, 최고 속도 MOTOR_MAX_SPEED, 감속)로
+ * 목표까지 움직이고, PWM은 속도/가속도 피드포워드(MOTOR_KV, MOTOR_KA)에 기준 위치와의 오차에 대한 PID를 더한 값입니다.
+ * 모터가 기준 위치를 늦게 따라가지 않으므로 감속 구간에서 목표를 지나치지 않고, 예전처럼 고정 PWM으로 돌다 멈춰 미끄러지는 일이 없습니다.
+ * 멈출 때마다 시작부터 걸린 시간(settle_ms)과 목표를 지나친 최대 거리(overshoot)를 남깁니다.
+ * 게인과 프로필은 스케치에서 미리 정의해서 바꿀 수 있으며, host/bench_motion.cpp의 모터 모델로 확인합니다.
+ */
+#ifndef MOTOR_MAX_SPEED
+#define MOTOR_MAX_SPEED 3000.0f  // 센서 단위/초
+#endif
+#ifndef MOTOR_ACCEL
+#define MOTOR_ACCEL 40000.0f  // 센서 단위/초^2
+#endif
+#ifndef MOTOR_KP
+#define MOTOR_KP 4.0f
+#endif
+#ifndef MOTOR_KI
+#define MOTOR_KI 0.0f
+#endif
+#ifndef MOTOR_KD
+#define MOTOR_KD 0.02f
+#endif
+#ifndef MOTOR_KV
+#define MOTOR_KV 0.051f  // 속도(센서 단위/초) -> PWM
+#endif
+#ifndef MOTOR_KA
+#define MOTOR_KA 0.0015f  // 가속도(센서 단위/초^2) -> PWM. 모터의 시정수만큼 속도가 늦게 따라오는 것을 보상합니다.
+#endif
+#ifndef MOTOR_SETTLE_US
+#define MOTOR_SETTLE_US 5000
+#endif
+constexpr int MOTOR_TOLERANCE = 3;
+constexpr int MOTOR_OVERLAP_WINDOW = 24;
+enum class MotorState : uint8_t {
+  IDLE,
+  MOVING,
+  SETTLING,
+};
+struct MotorAxis {
+  MotorState state = MotorState::IDLE;
+  bool done = false;  // 마지막으로 시작한 회전이 끝났는지 나타냅니다. 다음 motor_start()에서 지워집니다.
+  int32_t position = 0;  // 마지막으로 본 sensor_position입니다.
+  int32_t start = 0;     // 프로필의 시작 위치입니다.
+  int32_t target = 0;    // 풀어 쓴 목표 위치입니다.
+  uint32_t start_us = 0;
+  uint32_t last_us = 0;
+  uint32_t settle_begin_us = 0;  // 허용 오차 안에 들어온 시간입니다. 0이면 밖에 있습니다.
+  float integral = 0;
+  float last_error = 0;
+  uint16_t settle_ms = 0;  // 마지막 회전의 시작부터 멈출 때까지 걸린 시간입니다.
+  int16_t overshoot = 0;   // 마지막 회전이 목표를 지나친 최대 거리(센서 단위)입니다.
+  uint16_t iterations = 0;         // 마지막 회전의 제어 반복 수입니다.
+  uint16_t settle_iterations = 0;  // 그중 허용 오차 안에서 정착을 기다린 반복 수입니다.
+};
+MotorAxis motors[6];
+
+// 거리 distance(양수)를 움직이는 사다리꼴 프로필의 elapsed초 시점의 위치, 속도, 가속도를 구합니다. 끝났으면 false를 반환합니다.
+bool motor_profile(float distance, float elapsed, float& reference, float& velocity, float& accel) {
+  float accel_time = MOTOR_MAX_SPEED / MOTOR_ACCEL;
+  float accel_distance = 0.5f * MOTOR_ACCEL * accel_time * accel_time;
+  float peak = MOTOR_MAX_SPEED;
+  if (2 * accel_distance > distance) {  // 최고 속도에 닿기 전에 감속해야 하는 짧은 회전입니다.
+    accel_time = sqrtf(distance / MOTOR_ACCEL);
+    accel_distance = distance / 2;
+    peak = MOTOR_ACCEL * accel_time;
+  }
+  float cruise_time = (distance - 2 * accel_distance) / peak;
+  float total_time = 2 * accel_time + cruise_time;
+  if (elapsed < accel_time) {
+    reference = 0.5f * MOTOR_ACCEL * elapsed * elapsed;
+    velocity = MOTOR_ACCEL * elapsed;
+    accel = MOTOR_ACCEL;
+  } else if (elapsed < accel_time + cruise_time) {
+    reference = accel_distance + peak * (elapsed - accel_time);
+    velocity = peak;
+    accel = 0;
+  } else if (elapsed < total_time) {
+    float left = total_time - elapsed;
+    reference = distance - 0.5f * MOTOR_ACCEL * left * left;
+    velocity = MOTOR_ACCEL * left;
+    accel = -MOTOR_ACCEL;
+  } else {
+    reference = distance;
+    velocity = 0;
+    accel = 0;
+    return false;
+  }
+  return true;
+}
+
+// 축을 지금 면 위치(움직이는 중이면 이전 목표)에서 amount만큼 더 돌리기 시작합니다. amount는 [0,1024)이며 512를 넘으면 반시계방향입니다.
+// 멈춰 있던 축은 센서값을 가장 가까운 90도 위치로 맞춰서 허용 오차가 쌓이지 않게 합니다.
+void motor_start(int axis, int amount) {
+  MotorAxis& motor = motors[axis];
+  motor.position = sensor_position[axis];
+  if (motor.state == MotorState::IDLE) {
+    motor.target = get_cube_area(motor.position) * 256;
+  }
+  motor.target += amount > 512 ? amount - 1024 : amount;
+  motor.start = motor.position;
+  motor.start_us = motor.last_us = micros();
+  motor.settle_begin_us = 0;
+  motor.integral = 0;
+  motor.last_error = 0;
+  motor.overshoot = 0;
+  motor.iterations = 0;
+  motor.settle_iterations = 0;
+  motor.state = MotorState::MOVING;
+  motor.done = false;
+}
+void motor_update() {  // 움직이는 모든 축을 한 번씩 목표 쪽으로 돌리거나 멈춥니다.
+  uint32_t now = micros();
+  for (int axis = 0; axis < 6; ++axis) {
+    MotorAxis& motor = motors[axis];
+    if (motor.state == MotorState::IDLE) {
+      continue;
+    }
+    motor.position = sensor_position[axis];
+    motor.iterations++;
+    int32_t distance = motor.target - motor.start;
+    int32_t remaining = motor.target - motor.position;
+    int8_t direction = distance < 0 ? -1 : 1;
+    int16_t passed = -remaining * direction;
+    motor.overshoot = passed > motor.overshoot ? passed : motor.overshoot;
+
+    float reference, velocity, accel;
+    bool profiling = motor_profile(distance * direction, (now - motor.start_us) * 1e-6f, reference, velocity, accel);
+    // 허용 오차 안에서도 MOTOR_SETTLE_US 동안은 계속 제어해서, 아직 움직이는 채로 멈춰 미끄러지지 않게 합니다.
+    if (!profiling && -MOTOR_TOLERANCE <= remaining && remaining <= MOTOR_TOLERANCE) {
+      motor.settle_iterations++;
+      if (motor.settle_begin_us == 0) {
+        motor.settle_begin_us = now | 1;  // 0은 "밖에 있음"이므로 쓰지 않습니다.
+      } else if (now - motor.settle_begin_us >= MOTOR_SETTLE_US) {
+        motor_stop(axis);
+        motor.state = MotorState::IDLE;
+        motor.done = true;
+        motor.settle_ms = (now - motor.start_us) / 1000;
+        TELEMETRY_MOTOR(axis, now - motor.start_us, motor.iterations, motor.settle_iterations);
+        continue;
+      }
+    } else {
+      motor.settle_begin_us = 0;
+    }
+    if (-MOTOR_OVERLAP_WINDOW <= remaining && remaining <= MOTOR_OVERLAP_WINDOW) {
+      motor.state = MotorState::SETTLING;
+    }
+
+    float dt = (now - motor.last_us) * 1e-6f;
+    motor.last_us = now;
+    float error = motor.start + reference * direction - motor.position;
+    motor.integral += error * dt;
+    float derivative = dt > 0 ? (error - motor.last_error) / dt : 0;
+    motor.last_error = error;
+    float pwm = (MOTOR_KV * velocity + MOTOR_KA * accel) * direction + MOTOR_KP * error + MOTOR_KI * motor.integral + MOTOR_KD * derivative;
+    int speed = pwm > 255 ? 255 : (pwm < -255 ? 255 : static_cast<int>(pwm < 0 ? -pwm : pwm));
+    if (pwm >= 0) {
+      motor_rotate_cw(axis, speed);
+    } else {
+      motor_rotate_ccw(axis, speed);
+    }
+  }
+}
+// 목표 회전값까지 회전하도록 하는 함수입니다. 끝날 때까지 기다리므로 cube_init()에서만 사용합니다.
+void motor_write(int axis, int target_rotate) {
+  motors[axis].state = MotorState::IDLE;
+  sensor_refresh();
+  motor_start(axis, ((target_rotate - get_cube_area(sensor_position[axis]) * 256) % 1024 + 1024) % 1024);
+  while (motors[axis].state != MotorState::IDLE) {
+    sensor_refresh();
+    motor_update();
+  }
 }
 
 // 변수들을 초기화하는 함수입니다.
@@ -63,16 +330,249 @@ void cube_init() {
     pinMode(MOTOR_DRIVER_IN1[axis], OUTPUT);
     pinMode(MOTOR_DRIVER_IN2[axis], OUTPUT);
     pinMode(SENSOR_OUT[axis], INPUT);
-
+  }
+  sensor_begin();
+#if CUBE_SOLVER == CUBE_SOLVER_OFFLOAD
+  Serial.begin(OFFLOAD_BAUD);
+#elif CUBE_TELEMETRY
+  Serial.begin(TELEMETRY_BAUD);
+#endif
+  for (int axis = 0; axis < 6; ++axis) {
     // 모든 축의 회전(HW)을 0으로 초기화하고, 회전값을 저장하는 변수(SW)들도 모두 0(또는 입력값)으로 초기화합니다.
     motor_write(axis, 0);
-    axis_old_rotation[axis] = axis_now_rotation[axis] = sensor_read(axis);
+    axis_old_rotation[axis] = axis_now_rotation[axis] = sensor_position[axis];
   }
 
   // init() 종료 시간을 프로그램 시작 시간으로 생각합니다.
   last_rotated = millis();
 }
 
+/* 해법 수행
+ *
+ * container의 해법을 단계별로 모터에 보냅니다. solution_begin()으로 시작하고, 끝날 때까지 매 루프마다
+ * solution_update()를 불러 줍니다(기다리지 않습니다).
+ * 마주 보는 면의 회전(parallel_step_end())은 한 단계로 묶어 동시에 돌리고,
+ * 앞 단계의 면들이 모두 SETTLING에 들어오면 마지막 정착을 기다리지 않고 다음 단계를 시작합니다.
+ *
+ * 해법은 solve()가 이미 가상 큐브에 적용했으므로, 모터가 돌리는 동안 그 축의 센서 변화는 rotate()하지 않습니다.
+ * 그 사이에 사람이 다른 면을 돌리면 solution_abort()로 아직 시작하지 않은 회전을 가상 큐브에서 되돌리고 멈춥니다.
+ *
+ * CUBE_SOLVER_OFFLOAD에서 호스트의 답이 아직 오는 중에 시작했으면, 받는 대로 가상 큐브에 적용하고 solution_end를 늘려 이어서 수행합니다.
+ * 답이 끝나거나 끊길 때까지는 마치지 않습니다. 끝에서 맞춰지지 않았으면 다음 3초 뒤에 다시 풉니다.
+ */
+bool solution_running = false;
+uint16_t solution_next = 0;  // 다음에 시작할 회전의 위치입니다.
+uint16_t solution_end = 0;   // 해법의 끝입니다. 수행 중 rotate()가 container에 덧붙이는 기록은 수행하지 않습니다.
+
+void solution_begin() {
+  history_reset();  // 해법은 이미 가상 큐브에 적용했으므로 지금부터의 회전이 맞춰진 상태부터의 기록입니다.
+  solution_running = true;
+  solution_next = 0;
+  solution_end = container.length();
+}
+void solution_update() {
+#if CUBE_SOLVER == CUBE_SOLVER_OFFLOAD
+  if (offload_state != OffloadState::IDLE) {
+    if (offload_receive() || offload_expired()) {
+      offload_cancel();
+      history_valid = history_valid && cube.solved();  // 기록은 맞춰진 상태부터여야 합니다.
+    }
+    solution_end = container.length();
+  }
+#endif
+  if (solution_next < solution_end) {
+    for (int axis = 0; axis < 6; ++axis) {
+      if (motors[axis].state == MotorState::MOVING) {
+        return;
+      }
+    }
+    uint16_t step_end = parallel_step_end(container, solution_next);
+    for (; solution_next < step_end; ++solution_next) {
+      uint8_t axis, count;
+      if (parse_move_char(container[solution_next], axis, count)) {
+        motor_start(axis, count * 256 % 1024);  // 90도 우회전 256, 180도 512, 90도 좌회전 768
+      }
+    }
+    return;
+  }
+  for (int axis = 0; axis < 6; ++axis) {
+    if (motors[axis].state != MotorState::IDLE) {
+      return;
+    }
+  }
+#if CUBE_SOLVER == CUBE_SOLVER_OFFLOAD
+  if (offload_state != OffloadState::IDLE) {
+    return;
+  }
+#endif
+  solution_running = false;
+  last_rotated = millis();  // 해법을 마친 뒤에도 3초 동안은 다시 풀지 않습니다.
+}
+void solution_abort() {
+#if CUBE_SOLVER == CUBE_SOLVER_OFFLOAD
+  if (offload_state != OffloadState::IDLE) {  // 받지 못한 회전이 있으므로 되돌려도 맞춰진 상태가 아닙니다.
+    offload_cancel();
+    history_valid = false;
+  }
+#endif
+  for (uint16_t i = solution_end; i > solution_next; --i) {
+    uint8_t axis, count;
+    if (parse_move_char(container[i - 1], axis, count)) {
+      turn_cube_move(cube, axis * 3 + (4 - count) - 1);
+      history_record(axis, 4 - count);
+    }
+  }
+  solution_end = solution_next;
+}
+
+/* 미리 풀기
+ *
+ * 마지막 회전 뒤 3초를 기다리는 동안 해법을 단계별로 나눠서 cube_update()마다 한 단계씩 미리 구합니다.
+ * 층별 해법은 solve_stage()의 1~5단계, Thistlethwaite는 tw_phase_start()의 네 단계와 정리 한 단계가 한 번씩입니다.
+ * Thistlethwaite의 2, 4단계 탐색은 한 번에 THISTLETHWAITE_SLICE_NODES 노드씩 tw_phase_run()으로 나눠서 이어 갑니다.
+ * 호스트에 맡길 때(CUBE_SOLVER_OFFLOAD)는 시작할 때 요청을 보내고, 한 번마다 그때까지 받은 답을 적용합니다.
+ * 답이 맞지 않거나 OFFLOAD_TIMEOUT_MS 안에 오지 않으면 층별 해법으로 다시 구합니다.
+ * 3초가 되었을 때 답이 오는 중이면 받은 만큼부터 수행하고 나머지는 solution_update()가 이어 받습니다.
+ * 3초가 되면 다 구해 둔 해법을 바로 수행하고, 아직 남았으면 남은 단계만 이어서 구합니다.
+ * 다 구하면 history_shortcut()으로 사람이 돌린 기록을 되돌리는 쪽이 더 짧은지 확인해서 짧은 쪽을 씁니다.
+ *
+ * CUBE_NEUTRAL_FRAMES를 2 이상으로 정의하면 층별 해법을 다 구한 뒤 VirtualCube.h의 색 중립 해법을 예산 안에서 이어 갑니다.
+ * 한 번에 대칭 하나(solve_in_frame())씩, 대칭 1..CUBE_NEUTRAL_FRAMES-1을 차례로 풀어 가장 짧은 해법의 번호만 기억합니다.
+ * 3초가 되었거나 정한 수만큼 다 풀었으면 멈추고, 가장 짧은 해법이 container에 남아 있지 않으면 그 시점에서 한 번 더 풉니다.
+ * 기본값 1은 원래 시점만 풉니다. 24는 큐브를 돌린 시점 전부, 48은 거울상까지입니다.
+ *
+ * 해법은 전역 상태를 맞춰진 상태로 바꾸므로 시작할 때 상태를 저장해 둡니다.
+ * 그 사이에 면이 90도 이상 돌아가면 background_solve_discard()로 저장한 상태로 되돌리고 구하던 해법을 버린 뒤 rotate()합니다.
+ */
+constexpr uint32_t SOLVE_IDLE_MS = 3000;       // 마지막 회전 뒤 해법을 수행하기까지 기다리는 시간입니다.
+constexpr uint32_t SOLVE_BACKGROUND_MS = 200;  // 연달아 돌리는 중에는 시작하지 않도록, 이만큼 멈춰 있으면 미리 풀기 시작합니다.
+#ifndef CUBE_NEUTRAL_FRAMES
+#define CUBE_NEUTRAL_FRAMES 1
+#endif
+uint8_t background_stage = 0;  // 다음에 구할 단계입니다. 0이면 구하는 중인 해법이 없습니다.
+bool background_ready = false;
+bool background_lbl = true;    // 층별 해법의 단계를 구하는 중인지 나타냅니다.
+#if CUBE_SOLVER == CUBE_SOLVER_THISTLETHWAITE
+bool background_searching = false;  // background_stage의 탐색이 아직 끝나지 않았는지 나타냅니다.
+#endif
+CubeState background_saved;
+#if CUBE_NEUTRAL_FRAMES > 1
+uint8_t neutral_frame = 0;  // 다음에 풀어 볼 대칭입니다. container에는 neutral_frame - 1의 해법이 있습니다.
+uint8_t neutral_best = 0;
+uint16_t neutral_best_length = 0;
+#endif
+
+void background_solve_restore() {
+  cube = background_saved;
+  container.clear();
+}
+void background_solve_begin() {
+  background_saved = cube;
+  container.clear();
+  background_stage = 1;
+  background_ready = false;
+#if CUBE_SOLVER == CUBE_SOLVER_THISTLETHWAITE
+  background_lbl = false;
+  background_searching = false;
+  thistlethwaite_begin();
+#elif CUBE_SOLVER == CUBE_SOLVER_OFFLOAD
+  background_lbl = false;
+  offload_request();
+#else
+  background_lbl = true;
+#endif
+}
+void background_solve_finish() {  // 해법을 다 구했으면 되돌리기 해법과 비교해서 짧은 쪽을 남깁니다.
+  history_shortcut(background_saved);
+  background_ready = true;
+}
+#if CUBE_NEUTRAL_FRAMES > 1
+void background_solve_neutral() {  // 다른 시점에서 한 번 더 풀거나, 예산이 끝났으면 가장 짧은 해법을 남깁니다.
+  if (neutral_frame < CUBE_NEUTRAL_FRAMES && millis() - last_rotated < SOLVE_IDLE_MS) {
+    cube = background_saved;
+    bool mapped = solve_in_frame(neutral_frame);
+    if (mapped && !container.overflowed() && container.length() < neutral_best_length) {
+      neutral_best_length = container.length();
+      neutral_best = neutral_frame;
+    }
+    neutral_frame++;
+    return;
+  }
+  if (neutral_frame - 1 != neutral_best) {
+    cube = background_saved;
+    solve_in_frame(neutral_best);
+  }
+  background_solve_finish();
+}
+#endif
+void background_solve_slice() {  // 다음 한 단계를 구합니다.
+  TELEMETRY_STAGE_BEGIN();
+#if CUBE_SOLVER == CUBE_SOLVER_THISTLETHWAITE
+  if (!background_lbl) {  // thistlethwaite_solve()와 같은 순서입니다.
+    if (background_stage <= 4) {
+      uint8_t state = background_searching ? tw_phase_run(background_stage - 1, tw_node_count + THISTLETHWAITE_SLICE_NODES)
+                                           : tw_phase_start(background_stage - 1);
+      TELEMETRY_STAGE(10 + background_stage);
+      background_searching = state == TW_PHASE_RUNNING;
+      if (state == TW_PHASE_RUNNING) {
+        return;
+      }
+      if (state == TW_PHASE_DONE) {
+        background_stage++;
+      } else {  // 노드 예산을 넘겼으면 처음 상태에서 층별 해법으로 다시 구합니다.
+        background_solve_restore();
+        background_lbl = true;
+        background_stage = 1;
+      }
+      return;
+    }
+    thistlethwaite_end();
+    TELEMETRY_STAGE(15);
+    background_solve_finish();
+    return;
+  }
+#elif CUBE_SOLVER == CUBE_SOLVER_OFFLOAD
+  if (!background_lbl) {  // 받은 만큼 적용합니다.
+    if (offload_receive() && cube.solved()) {
+      background_solve_finish();
+    } else if (offload_state == OffloadState::IDLE || offload_expired()) {  // 답이 틀렸거나 오지 않았습니다.
+      offload_cancel();
+      background_solve_restore();
+      background_lbl = true;
+    }
+    return;
+  }
+#endif
+#if CUBE_NEUTRAL_FRAMES > 1
+  if (background_stage > SOLVE_FINAL_STAGE) {
+    background_solve_neutral();
+    TELEMETRY_STAGE(20);
+    return;
+  }
+#endif
+  solve_stage(background_stage);
+  TELEMETRY_STAGE(background_stage);
+  if (background_stage++ == SOLVE_FINAL_STAGE) {
+#if CUBE_NEUTRAL_FRAMES > 1
+    neutral_frame = 1;  // 원래 시점(대칭 0)의 해법은 방금 구했습니다.
+    neutral_best = 0;
+    neutral_best_length = container.overflowed() ? 0xFFFF : container.length();
+#else
+    background_solve_finish();
+#endif
+  }
+}
+void background_solve_discard() {
+  if (background_stage != 0) {
+#if CUBE_SOLVER == CUBE_SOLVER_OFFLOAD
+    offload_cancel();
+#endif
+    background_solve_restore();
+    background_stage = 0;
+    background_ready = false;
+  }
+}
+
 /* 2. 메인 로직 함수
  * 
  * 모터의 입력을 처리하는 부분입니다.
@@ -80,42 +580,75 @@ void cube_init() {
  */
 void cube_update() {
   // 모든 축의 회전을 감지해서 그 수치가 일정치를 넘으면 VirtualCube의 회전을 수행합니다.
+  // 모터가 돌리고 있는 축은 해법으로 이미 가상 큐브에 반영했으므로 건너뜁니다.
+  // 누적 회전값으로 비교하므로 루프 사이에 두 칸 이상 돌아가도 그만큼 모두 rotate()합니다.
+  TELEMETRY_LOOP();
+  sensor_refresh();
   for (int axis = 0; axis < 6; ++axis) {
     axis_old_rotation[axis] = axis_now_rotation[axis];
-    axis_now_rotation[axis] = sensor_read(axis);
+    axis_now_rotation[axis] = sensor_position[axis];
+    if (motors[axis].state != MotorState::IDLE) {
+      continue;
+    }
     if (axis_old_rotation[axis] != axis_now_rotation[axis]) {  // 회전이 감지되지 않았을 경우입니다.
-      int old_area = get_cube_area(axis_old_rotation[axis]);
-      int now_area = get_cube_area(axis_now_rotation[axis]);
+      int32_t old_area = get_cube_area(axis_old_rotation[axis]);
+      int32_t now_area = get_cube_area(axis_now_rotation[axis]);
+      if (now_area != old_area) {
+        background_solve_discard();
+        if (solution_running) {
+          solution_abort();
+        }
+      }
 
-      rotate(static_cast<Color>(axis), (now_area - old_area + 4) % 4);
+      rotate(static_cast<Color>(axis), ((now_area - old_area) % 4 + 4) % 4);
+      history_record(axis, ((now_area - old_area) % 4 + 4) % 4);
       last_rotated = millis();
     }
   }
+  motor_update();
+  if (solution_running) {
+    solution_update();
+    return;
+  }
+#if CUBE_TELEMETRY
+#if CUBE_SOLVER == CUBE_SOLVER_OFFLOAD
+  if (offload_state == OffloadState::IDLE)  // 답을 받는 중에는 그 바이트를 건드리지 않습니다.
+#endif
+    telemetry_poll();
+#endif
+
+  // 멈춰 있는 동안 해법을 한 단계씩 미리 구합니다.
+  uint32_t idle_ms = millis() - last_rotated;
+  if (idle_ms >= SOLVE_BACKGROUND_MS && !background_ready) {
+    if (background_stage == 0) {
+      background_solve_begin();
+    }
+    background_solve_slice();
+  }
 
-  // 마지막으로 회전값이 변한 이후로 3초 이상 지나면 해법을 계산 및 수행하도록 합니다.
-  if (millis() - last_rotated >= 3000) {
-    // 해법을 계산 및 수행합니다.
-    solve();
-    for (char c : container) {
-      switch (c) {
-        case 'W': motor_write(0, (sensor_read(0) + 256) % 1024); break; // 90도 우회전
-        case 'Y': motor_write(1, (sensor_read(1) + 256) % 1024); break;
-        case 'G': motor_write(2, (sensor_read(2) + 256) % 1024); break;
-        case 'B': motor_write(3, (sensor_read(3) + 256) % 1024); break;
-        case 'O': motor_write(4, (sensor_read(4) + 256) % 1024); break;
-        case 'R': motor_write(5, (sensor_read(5) + 256) % 1024); break;
-
-        case 'w': motor_write(0, (sensor_read(0) + 768) % 1024); break; // 90도 좌회전
-        case 'y': motor_write(1, (sensor_read(1) + 768) % 1024); break;
-        case 'g': motor_write(2, (sensor_read(2) + 768) % 1024); break;
-        case 'b': motor_write(3, (sensor_read(3) + 768) % 1024); break;
-        case 'o': motor_write(4, (sensor_read(4) + 768) % 1024); break;
-        case 'r': motor_write(5, (sensor_read(5) + 768) % 1024); break;
+  // 마지막으로 회전값이 변한 이후로 3초 이상 지나면 해법을 수행하도록 합니다.
+  if (idle_ms >= SOLVE_IDLE_MS) {
+    if (background_stage == 0) {
+      background_solve_begin();
+    }
+#if CUBE_SOLVER == CUBE_SOLVER_OFFLOAD
+    if (!background_lbl && !background_ready) {
+      background_solve_slice();
+      if (!background_lbl && !background_ready) {
+        if (offload_state == OffloadState::MOVES) {  // 답이 오는 중이면 받은 만큼부터 수행합니다.
+          background_stage = 0;
+          solution_begin();
+        }
+        return;  // 답이 시작되지 않았으면 기다립니다(시간이 지나면 층별 해법으로 바뀝니다).
       }
     }
-
-    // 만일을 대비한 delay() 입니다
-    delay(500);
+#endif
+    while (!background_ready) {
+      background_solve_slice();
+    }
+    background_stage = 0;
+    background_ready = false;
+    solution_begin();
   }
 }
 
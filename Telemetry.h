@@ -0,0 +1,180 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include "VirtualCube.h"
+
+/* 텔레메트리
+ *
+ * 스케치에서 CUBE_TELEMETRY를 1로 정의하면 시간이 어디에 쓰이는지 기록합니다. 기본값 0에서는 기록 매크로가 모두 비어 있어서 코드가 생기지 않습니다.
+ *
+ * 고정 크기 링 버퍼(TELEMETRY_CAPACITY개, 한 개에 10바이트)에 아래 기록을 남기며, 가득 차면 가장 오래된 기록을 덮어씁니다.
+ *   S 단계   미리 풀기 한 번(background_solve_slice())의 시간(us)과 덧붙인 회전 수
+ *            층별 해법은 1~5단계, Thistlethwaite는 11~14(1~4단계)와 15(정리)이며, 정리 단계(5, 15)의 회전 수는 줄어든 만큼 음수입니다.
+ *            Thistlethwaite의 2, 4단계(12, 14)는 탐색을 나눠서 하므로 한 단계에 여러 개가 남고, 마지막 것에만 회전 수가 있습니다.
+ *            색 중립 해법(CUBE_NEUTRAL_FRAMES)이 다른 시점에서 한 번 더 푼 것은 20이며, 회전 수는 해법 길이가 바뀐 만큼입니다.
+ *   M 축     회전 하나의 시작부터 멈출 때까지의 시간(us), 제어 반복 수, 그중 허용 오차 안에서 정착하며 반복한 수
+ *   L        메인 루프 TELEMETRY_LOOP_WINDOW번의 평균 주기(us), 최대 주기(us), 루프 수
+ * 시간은 micros()로 재므로 AVR에서는 4us 단위입니다(16MHz에서 64클럭).
+ * 따로 메인 루프 주기(us)와 모터 회전 시간(ms)의 2의 거듭제곱 구간 히스토그램을 셉니다.
+ *
+ * 해법을 수행하고 있지 않을 때 Serial로 TELEMETRY_DUMP_REQUEST('?')를 받으면 telemetry_dump()로 모두 글자로 보낸 뒤 비웁니다.
+ * 보내는 동안(115200bps에서 수십 ms) 루프가 멈추므로 모터가 돌 때는 보내지 않습니다.
+ */
+#ifndef CUBE_TELEMETRY
+#define CUBE_TELEMETRY 0
+#endif
+
+#if CUBE_TELEMETRY
+#ifndef TELEMETRY_CAPACITY
+#define TELEMETRY_CAPACITY 32
+#endif
+#ifndef TELEMETRY_LOOP_WINDOW
+#define TELEMETRY_LOOP_WINDOW 1024
+#endif
+#ifndef TELEMETRY_BAUD
+#define TELEMETRY_BAUD 115200
+#endif
+constexpr uint8_t TELEMETRY_DUMP_REQUEST = '?';
+constexpr uint8_t TELEMETRY_BUCKETS = 16;
+
+enum class TelemetryKind : uint8_t {
+  STAGE = 'S',
+  MOTOR = 'M',
+  LOOP = 'L',
+};
+struct TelemetryRecord {
+  TelemetryKind kind;
+  uint8_t index;    // 단계 또는 축
+  uint16_t count;   // 회전 수(단계에서는 int16_t), 제어 반복 수, 평균 주기
+  uint16_t detail;  // 정착 반복 수, 루프 수
+  uint32_t value;   // 시간(us)
+};
+TelemetryRecord telemetry_records[TELEMETRY_CAPACITY];
+uint8_t telemetry_next = 0;       // 다음에 쓸 위치입니다.
+uint16_t telemetry_count = 0;     // 비운 뒤 남긴 기록 수입니다. TELEMETRY_CAPACITY를 넘은 만큼 덮어썼습니다.
+uint16_t telemetry_loop_histogram[TELEMETRY_BUCKETS];   // 구간 b: [2^b, 2^(b+1)) us
+uint16_t telemetry_motor_histogram[TELEMETRY_BUCKETS];  // 구간 b: [2^b, 2^(b+1)) ms
+uint32_t telemetry_loop_last_us = 0;
+uint32_t telemetry_loop_sum_us = 0;
+uint32_t telemetry_loop_max_us = 0;
+uint16_t telemetry_loop_count = 0;
+
+inline uint8_t telemetry_bucket(uint32_t value) {
+  uint8_t bucket = 0;
+  while (value > 1 && bucket < TELEMETRY_BUCKETS - 1) {
+    value >>= 1;
+    bucket++;
+  }
+  return bucket;
+}
+inline void telemetry_record(TelemetryKind kind, uint8_t index, uint16_t count, uint16_t detail, uint32_t value) {
+  telemetry_records[telemetry_next] = { kind, index, count, detail, value };
+  telemetry_next = (telemetry_next + 1) % TELEMETRY_CAPACITY;
+  telemetry_count += telemetry_count < 0xFFFF;
+}
+inline void telemetry_stage(uint8_t stage, uint32_t begin_us, uint16_t begin_length) {
+  telemetry_record(TelemetryKind::STAGE, stage, container.length() - begin_length, 0, micros() - begin_us);
+}
+inline void telemetry_motor(uint8_t axis, uint32_t duration_us, uint16_t iterations, uint16_t settle_iterations) {
+  telemetry_record(TelemetryKind::MOTOR, axis, iterations, settle_iterations, duration_us);
+  uint16_t& bucket = telemetry_motor_histogram[telemetry_bucket(duration_us / 1000)];
+  bucket += bucket < 0xFFFF;
+}
+inline void telemetry_loop() {  // 메인 루프마다 한 번 부릅니다.
+  uint32_t now = micros();
+  if (telemetry_loop_last_us != 0) {
+    uint32_t period = now - telemetry_loop_last_us;
+    uint16_t& bucket = telemetry_loop_histogram[telemetry_bucket(period)];
+    bucket += bucket < 0xFFFF;
+    telemetry_loop_sum_us += period;
+    telemetry_loop_max_us = period > telemetry_loop_max_us ? period : telemetry_loop_max_us;
+    if (++telemetry_loop_count == TELEMETRY_LOOP_WINDOW) {
+      uint32_t mean = telemetry_loop_sum_us / telemetry_loop_count;
+      telemetry_record(TelemetryKind::LOOP, 0, mean < 0xFFFF ? mean : 0xFFFF, telemetry_loop_count, telemetry_loop_max_us);
+      telemetry_loop_sum_us = telemetry_loop_max_us = 0;
+      telemetry_loop_count = 0;
+    }
+  }
+  telemetry_loop_last_us = now | 1;  // 0은 "처음"이므로 쓰지 않습니다.
+}
+inline void telemetry_clear() {
+  telemetry_next = 0;
+  telemetry_count = 0;
+  memset(telemetry_loop_histogram, 0, sizeof(telemetry_loop_histogram));
+  memset(telemetry_motor_histogram, 0, sizeof(telemetry_motor_histogram));
+  telemetry_loop_last_us = 0;  // 보내는 동안 멈춘 시간은 주기에 넣지 않습니다.
+  telemetry_loop_sum_us = telemetry_loop_max_us = 0;
+  telemetry_loop_count = 0;
+}
+inline void telemetry_print_histogram(const uint16_t histogram[TELEMETRY_BUCKETS]) {
+  for (uint8_t bucket = 0; bucket < TELEMETRY_BUCKETS; ++bucket) {
+    Serial.print(' ');
+    Serial.print(histogram[bucket]);
+  }
+  Serial.println();
+}
+/* 보내는 형식(한 줄에 하나, 공백 구분)
+ *   T <millis()> <남긴 기록 수> <덮어쓴 기록 수>
+ *   H loop-us <16개 구간>
+ *   H motor-ms <16개 구간>
+ *   S <단계> <us> <회전 수> / M <축> <us> <반복 수> <정착 반복 수> / L 0 <최대 us> <평균 us> <루프 수>   (오래된 것부터)
+ *   E
+ */
+inline void telemetry_dump() {
+  uint8_t kept = telemetry_count < TELEMETRY_CAPACITY ? telemetry_count : TELEMETRY_CAPACITY;
+  Serial.print(F("T "));
+  Serial.print(millis());
+  Serial.print(' ');
+  Serial.print(kept);
+  Serial.print(' ');
+  Serial.println(telemetry_count - kept);
+  Serial.print(F("H loop-us"));
+  telemetry_print_histogram(telemetry_loop_histogram);
+  Serial.print(F("H motor-ms"));
+  telemetry_print_histogram(telemetry_motor_histogram);
+  for (uint8_t i = 0; i < kept; ++i) {
+    const TelemetryRecord& record = telemetry_records[(telemetry_next + TELEMETRY_CAPACITY - kept + i) % TELEMETRY_CAPACITY];
+    Serial.print(static_cast<char>(record.kind));
+    Serial.print(' ');
+    Serial.print(record.index);
+    Serial.print(' ');
+    Serial.print(record.value);
+    Serial.print(' ');
+    if (record.kind == TelemetryKind::STAGE) {
+      Serial.println(static_cast<int16_t>(record.count));
+    } else {
+      Serial.print(record.count);
+      Serial.print(' ');
+      Serial.println(record.detail);
+    }
+  }
+  Serial.println('E');
+  telemetry_clear();
+}
+// Serial로 요청이 왔으면 보냅니다. 받은 바이트는 모두 읽어서 버립니다(시리얼 모니터가 붙이는 줄바꿈 등이 남아 다음 요청을 막지 않도록).
+// Offload.h의 답을 받는 중에는 부르지 않습니다(PhysicalCube.h의 cube_update() 참고).
+inline void telemetry_poll() {
+  bool requested = false;
+  while (Serial.available() > 0) {
+    requested |= Serial.read() == TELEMETRY_DUMP_REQUEST;
+  }
+  if (requested) {
+    telemetry_dump();
+  }
+}
+
+#define TELEMETRY_LOOP() telemetry_loop()
+#define TELEMETRY_STAGE_BEGIN() \
+  uint32_t telemetry_begin_us = micros(); \
+  uint16_t telemetry_begin_length = container.length()
+#define TELEMETRY_STAGE(stage) telemetry_stage((stage), telemetry_begin_us, telemetry_begin_length)
+#define TELEMETRY_MOTOR(axis, duration_us, iterations, settle_iterations) \
+  telemetry_motor((axis), (duration_us), (iterations), (settle_iterations))
+#else
+#define TELEMETRY_LOOP()
+#define TELEMETRY_STAGE_BEGIN()
+#define TELEMETRY_STAGE(stage)
+#define TELEMETRY_MOTOR(axis, duration_us, iterations, settle_iterations)
+#endif
+
+#endif  // !TELEMETRY_H
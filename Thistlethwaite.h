@@ -0,0 +1,380 @@
+#ifndef THISTLETHWAITE_H
+#define THISTLETHWAITE_H
+
+#include "Coordinates.h"
+
+/* Thistlethwaite 해법
+ *
+ * 장치(ATmega328) 안에서 solve()보다 짧은 해법을 구하기 위한 해법입니다.
+ * 큐브를 네 단계에 걸쳐 점점 작은 부분군으로 옮깁니다.
+ *
+ * 1단계: G0 -> G1 = <W, Y, G, B, O2, R2>     엣지 방향(flip)을 맞춥니다.              최대 7회
+ * 2단계: G1 -> G2 = <W, Y, G2, B2, O2, R2>   코너 방향(twist)과 가운데 층 엣지를 맞춥니다. 최대 10회
+ * 3단계: G2 -> G3 = <W2, Y2, G2, B2, O2, R2> 코너를 두 묶음(tetrad)에, 엣지를 각 층에 넣습니다. 최대 13회
+ * 4단계: G3 -> 맞춰진 상태                    180도 회전만으로 마무리합니다.             최대 15회
+ * 합쳐서 180도 회전을 1회로 세어 최대 45회입니다.
+ *
+ * 각 단계의 최소 회전 수 표는 host/thistlethwaite_gen.cpp가 만든 ThistlethwaiteTables.h에 PROGMEM으로 들어 있으며,
+ * 값은 최소 회전 수를 3으로 나눈 나머지를 2비트씩 저장합니다(3은 도달할 수 없는 좌표).
+ * 이웃한 상태의 거리는 1 이내로만 차이 나므로, 나머지만으로도 한 칸 가까워지는 회전을 알 수 있습니다.
+ *   1, 3단계: 표가 단계 전체를 담고 있으므로 가까워지는 회전을 고르기만 하면 됩니다(탐색 없음).
+ *   2, 4단계: 좌표를 여러 부분으로 나눈 표의 가장 큰 값을 하한으로 쓰는 IDA* 탐색입니다.
+ * 표는 모두 합쳐 약 12KB입니다.
+ *
+ * 좌표 함수들이 자리별 배열을 받으므로 전역 상태(cube)를 배열(tw_corner_pos 등, 40바이트)로 풀어 놓고 그 복사본을 돌려 가며 탐색합니다.
+ * 그 밖의 SRAM은 탐색 경로와 깊이마다의 다음 회전, 부분 거리(합쳐서 약 100바이트)뿐이며, 해법을 찾으면 배열을 다시 묶어 cube에 넣습니다.
+ * 2, 4단계의 탐색 노드가 THISTLETHWAITE_NODE_BUDGET을 넘으면 cube를 건드리지 않은 채로 solve()로 대신합니다.
+ * 탐색은 재귀 대신 깊이별 상태를 전역에 두고 돌므로, 정한 노드 수만큼 나아간 뒤 멈췄다가 이어서 할 수 있습니다(PhysicalCube.h의 미리 풀기).
+ */
+#ifndef THISTLETHWAITE_NODE_BUDGET
+#define THISTLETHWAITE_NODE_BUDGET 50000
+#endif
+#ifndef THISTLETHWAITE_SLICE_NODES
+#define THISTLETHWAITE_SLICE_NODES 100  // 미리 풀기 한 번에 나아갈 탐색 노드 수입니다.
+#endif
+
+constexpr uint16_t TW_PHASE3_COUNT = 29400;     // (코너 묶음 70 * 코너 순서 6) * 엣지 층 70
+constexpr uint8_t TW_HALF_TURN_CORNER_COUNT = 96;
+constexpr uint16_t TW_PHASE4_CORNER_LAYER_COUNT = 96 * 24;
+constexpr uint16_t TW_PHASE4_EDGE_COUNT = 6912;  // 24 * 24 * 24 / 2
+constexpr uint8_t TW_UNREACHED = 3;
+constexpr uint8_t TW_SEARCH_DEPTH_LIMIT = 15;
+
+#ifndef THISTLETHWAITE_NO_TABLES
+#include "ThistlethwaiteTables.h"
+#endif
+
+/* 1. 단계별 좌표
+ *
+ * 각 단계의 회전은 시계/반시계 90도를 쓸 수 있는 축의 비트마스크로 정합니다. 나머지 축은 180도만 씁니다.
+ * 엣지의 층은 가운데 층(4~7), O/R 면에 닿지 않는 윗면/아랫면 엣지(TW_M_SLICE_MASK), 나머지의 셋입니다.
+ */
+CUBE_THREAD_LOCAL uint8_t tw_corner_pos[8], tw_corner_ori[8], tw_edge_pos[12], tw_edge_ori[12];  // 탐색 중인 상태입니다.
+constexpr uint8_t tw_quarter_axes[4] = {
+  0b111111,  // 1단계: 모든 회전
+  0b001111,  // 2단계: O, R은 180도만
+  0b000011,  // 3단계: W, Y만 90도
+  0b000000,  // 4단계: 180도만
+};
+inline bool tw_move_allowed(uint8_t phase, uint8_t move) {
+  return move_count(move) == 2 || (tw_quarter_axes[phase] >> move_axis(move) & 1);
+}
+inline uint8_t inverse_move(uint8_t move) {
+  return move - move % 3 + (2 - move % 3);
+}
+
+// 여덟 자리에 놓인 조각 중 mask에 속한 조각이 차지한 자리의 조합 번호(0..69)입니다.
+inline uint8_t tw_choose8(const uint8_t pieces[8], uint16_t mask) {
+  uint8_t combination = 0;
+  uint8_t found = 0;
+  for (int k = 7; k >= 0; --k) {
+    if (mask >> pieces[k] & 1) {
+      combination += choose(7 - k, found + 1);
+      found++;
+    }
+  }
+  return combination;
+}
+// mask 안팎 중 piece와 같은 쪽에 있는 조각들 사이에서 piece의 순위입니다.
+inline uint8_t tw_rank_in(uint16_t mask, uint8_t piece) {
+  uint8_t rank = 0;
+  for (uint8_t other = 0; other < piece; ++other) {
+    rank += (mask >> other & 1) == (mask >> piece & 1);
+  }
+  return rank;
+}
+
+// 3단계의 코너 좌표(0..419)입니다.
+// 코너는 180도 회전으로 서로 섞이지 않는 두 묶음(A: TW_TETRAD_MASK, B: 나머지)으로 나뉩니다.
+// A 묶음 조각이 놓인 자리의 조합(70)에, 조각 번호를 A 묶음이 자리 순서대로 오도록 180도 회전 배치로 바꿔 붙였을 때
+// B 묶음 순서가 속하는 S4/V4의 종류(6)를 묶습니다. G3의 코너 배치(96가지)에서만 0이 됩니다.
+inline uint16_t tw_phase3_corner() {
+  uint8_t seq_a[4], seq_b[4];
+  uint8_t found_a = 0, found_b = 0;
+  for (uint8_t pos = 0; pos < 8; ++pos) {
+    uint8_t piece = tw_corner_pos[pos];
+    if (TW_TETRAD_MASK >> piece & 1) {
+      seq_a[found_a++] = tw_rank_in(TW_TETRAD_MASK, piece);
+    } else {
+      seq_b[found_b++] = tw_rank_in(TW_TETRAD_MASK, piece);
+    }
+  }
+  uint8_t relabel_b[4];
+  set_perm(relabel_b, 4, pgm_read_byte(&tw_tetrad_relabel[get_perm(seq_a, 4)]));
+  for (uint8_t i = 0; i < 4; ++i) {
+    seq_b[i] = relabel_b[seq_b[i]];
+  }
+  return tw_choose8(tw_corner_pos, TW_TETRAD_MASK) * 6 + pgm_read_byte(&tw_s4_class[get_perm(seq_b, 4)]);
+}
+// 3단계의 엣지 좌표(0..69)입니다. 윗면/아랫면 자리 8개 중 TW_M_SLICE_MASK 엣지가 놓인 자리의 조합입니다.
+inline uint8_t tw_phase3_edge() {
+  uint8_t pieces[8];
+  for (uint8_t i = 0; i < 8; ++i) {
+    pieces[i] = tw_edge_pos[ud_edge_positions[i]];
+  }
+  return tw_choose8(pieces, TW_M_SLICE_MASK);
+}
+
+// 4단계의 코너 좌표(0..95)입니다. 180도 회전으로 만들 수 있는 코너 배치 목록(정렬됨)에서의 번호입니다.
+inline uint8_t tw_phase4_corner() {
+  uint16_t corner_perm = get_corner_perm(tw_corner_pos);
+  uint8_t low = 0, high = TW_HALF_TURN_CORNER_COUNT - 1;
+  while (low < high) {
+    uint8_t mid = (low + high) / 2;
+    if (pgm_read_word(&tw_half_turn_corners[mid]) < corner_perm) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return low;
+}
+// 4단계의 엣지 좌표입니다. 엣지의 층은 M(0), S(1), E(2, 가운데 층 4~7)의 셋입니다.
+inline uint8_t tw_edge_layer(uint8_t edge) {
+  return edge >= 4 && edge < 8 ? 2 : (TW_M_SLICE_MASK >> edge & 1 ? 0 : 1);
+}
+// 한 층 안에서 엣지 네 개의 순서(0..23)입니다.
+inline uint8_t tw_layer_perm(uint8_t layer) {
+  uint8_t perm[4];
+  uint8_t found = 0;
+  for (uint8_t pos = 0; pos < 12; ++pos) {
+    if (tw_edge_layer(pos) == layer) {
+      uint8_t rank = 0;
+      for (uint8_t other = 0; other < tw_edge_pos[pos]; ++other) {
+        rank += tw_edge_layer(other) == layer;
+      }
+      perm[found++] = rank;
+    }
+  }
+  return get_perm(perm, 4);
+}
+// 세 층의 순서를 묶은 값(0..6911)입니다. 전체 짝홀성으로 결정되는 마지막 층 순서의 마지막 자리를 뺍니다.
+inline uint16_t tw_phase4_edge() {
+  return ((tw_layer_perm(0) * 24 + tw_layer_perm(1)) * 24 + tw_layer_perm(2)) / 2;
+}
+
+// 단계와 부분을 인자로 현재 상태의 좌표를 구합니다.
+// 2단계는 twist와 가운데 층 엣지의 자리, 4단계는 코너와 각 층 순서의 조합 셋과 엣지 전체로 좌표를 나눕니다.
+constexpr uint8_t TW_MAX_PARTS = 4;
+inline uint8_t tw_part_count(uint8_t phase) {
+  return phase == 0 || phase == 2 ? 1 : (phase == 1 ? 2 : 4);
+}
+inline uint16_t tw_coordinate(uint8_t phase, uint8_t part) {
+  switch (phase) {
+    case 0: return get_flip(tw_edge_ori);
+    case 1: return part == 0 ? get_twist(tw_corner_ori) : get_edge4(tw_edge_pos, EDGE_GROUP_SLICE) / 24;
+    case 2: return tw_phase3_corner() * 70 + tw_phase3_edge();
+    default: return part < 3 ? tw_phase4_corner() * 24 + tw_layer_perm(part) : tw_phase4_edge();
+  }
+}
+inline uint16_t tw_goal(uint8_t phase) {
+  return phase == 2 ? TW_PHASE3_SOLVED : 0;
+}
+
+/* 2. 최소 회전 수 표 */
+#ifndef THISTLETHWAITE_NO_TABLES
+inline const uint8_t* tw_table(uint8_t phase, uint8_t part) {
+  switch (phase) {
+    case 0: return tw_flip_distance;
+    case 1: return part == 0 ? tw_twist_distance : tw_slice_distance;
+    case 2: return tw_phase3_distance;
+    default: return part < 3 ? tw_corner_layer_distance[part] : tw_edge_distance;
+  }
+}
+inline uint8_t tw_distance_mod3(uint8_t phase, uint8_t part) {
+  uint16_t index = tw_coordinate(phase, part);
+  return pgm_read_byte(&tw_table(phase, part)[index / 4]) >> (index % 4 * 2) & 3;
+}
+// 부모의 정확한 거리와 자식의 (거리 % 3)으로 자식의 정확한 거리를 구합니다.
+inline uint8_t tw_next_distance(uint8_t distance, uint8_t child_mod3) {
+  switch ((child_mod3 + 3 - distance % 3) % 3) {
+    case 0: return distance;
+    case 1: return distance + 1;
+    default: return distance - 1;
+  }
+}
+
+/* 3. 탐색 */
+constexpr uint8_t TW_FAILED = 0xFF;
+CUBE_THREAD_LOCAL uint32_t tw_node_count;  // 이번 해법에서 2, 4단계가 방문한 노드 수입니다.
+CUBE_THREAD_LOCAL uint8_t tw_path[TW_SEARCH_DEPTH_LIMIT];
+CUBE_THREAD_LOCAL uint8_t tw_path_length;
+
+inline void tw_apply(uint8_t move) {
+  turn_cubies_move(tw_corner_pos, tw_corner_ori, tw_edge_pos, tw_edge_ori, move);
+}
+
+// part 좌표가 목표에 닿을 때까지 한 칸씩 가까워지는 회전을 적용합니다.
+// record가 true면 회전을 container에 기록하고 상태를 그대로 두며, false면 상태를 되돌리고 회전 수(정확한 거리)만 반환합니다.
+// 도달할 수 없는 좌표(잘못된 상태)면 TW_FAILED를 반환합니다.
+inline uint8_t tw_descend(uint8_t phase, uint8_t part, bool record) {
+  uint8_t distance = tw_distance_mod3(phase, part);
+  uint8_t steps = 0;
+  while (distance != TW_UNREACHED && tw_coordinate(phase, part) != tw_goal(phase)) {
+    uint8_t move = 0;
+    for (; move < MOVE_COUNT && steps < TW_SEARCH_DEPTH_LIMIT; ++move) {
+      if (!tw_move_allowed(phase, move)) {
+        continue;
+      }
+      tw_apply(move);
+      if (tw_distance_mod3(phase, part) == (distance + 2) % 3) {
+        break;
+      }
+      tw_apply(inverse_move(move));
+    }
+    if (move >= MOVE_COUNT || steps >= TW_SEARCH_DEPTH_LIMIT) {
+      distance = TW_UNREACHED;
+      break;
+    }
+    distance = (distance + 2) % 3;
+    tw_path[steps++] = move;
+    if (record) {
+      append_move(container, move);
+    }
+  }
+  if (!record) {
+    for (uint8_t i = steps; i > 0; --i) {
+      tw_apply(inverse_move(tw_path[i - 1]));
+    }
+  }
+  return distance == TW_UNREACHED ? TW_FAILED : steps;
+}
+
+// 2, 4단계의 IDA* 탐색입니다. 부분 좌표별 정확한 거리 중 가장 큰 값을 하한으로 씁니다.
+// 재귀와 같은 순서로 노드를 방문하되 깊이마다 다음에 해 볼 회전(tw_next_move)과 거리(tw_distance)를 전역에 두어서,
+// tw_phase_run()이 node_limit에서 멈췄다가 다음 호출에서 이어 갈 수 있습니다.
+constexpr uint8_t TW_PHASE_DONE = 0;     // 단계를 마쳤고 회전을 container에 기록했습니다.
+constexpr uint8_t TW_PHASE_FAILED = 1;   // 노드 예산을 넘겼거나 잘못된 상태입니다.
+constexpr uint8_t TW_PHASE_RUNNING = 2;  // 탐색 중에 멈췄습니다. tw_phase_run()으로 이어 갑니다.
+CUBE_THREAD_LOCAL uint8_t tw_bound;  // 이번 반복의 깊이 한도입니다.
+CUBE_THREAD_LOCAL uint8_t tw_depth;
+CUBE_THREAD_LOCAL bool tw_entering;  // tw_depth의 노드에 막 들어와서 아직 확인하지 않았는지 나타냅니다.
+CUBE_THREAD_LOCAL uint8_t tw_next_move[TW_SEARCH_DEPTH_LIMIT + 1];
+CUBE_THREAD_LOCAL uint8_t tw_distance[TW_SEARCH_DEPTH_LIMIT + 1][TW_MAX_PARTS];
+
+// 1, 3단계는 여기서 끝냅니다. 2, 4단계는 부분 거리를 구해서 탐색을 준비하고 TW_PHASE_RUNNING을 반환합니다.
+inline uint8_t tw_phase_start(uint8_t phase) {
+  uint8_t parts = tw_part_count(phase);
+  if (parts == 1) {
+    return tw_descend(phase, 0, true) != TW_FAILED ? TW_PHASE_DONE : TW_PHASE_FAILED;
+  }
+
+  tw_bound = 0;
+  for (uint8_t part = 0; part < parts; ++part) {
+    tw_distance[0][part] = tw_descend(phase, part, false);
+    if (tw_distance[0][part] == TW_FAILED) {
+      return TW_PHASE_FAILED;
+    }
+    tw_bound = tw_distance[0][part] > tw_bound ? tw_distance[0][part] : tw_bound;
+  }
+  if (tw_bound > TW_SEARCH_DEPTH_LIMIT || tw_node_count > THISTLETHWAITE_NODE_BUDGET) {
+    return TW_PHASE_FAILED;
+  }
+  tw_depth = 0;
+  tw_entering = true;
+  return TW_PHASE_RUNNING;
+}
+
+// tw_node_count가 node_limit에 닿을 때까지 탐색합니다. 해법을 찾으면 상태를 목표에 둔 채로 회전을 container에 기록합니다.
+inline uint8_t tw_phase_run(uint8_t phase, uint32_t node_limit) {
+  uint8_t parts = tw_part_count(phase);
+  while (true) {
+    uint8_t depth = tw_depth;
+    const uint8_t* distance = tw_distance[depth];
+    if (tw_entering) {
+      tw_entering = false;
+      uint8_t bound = 0;
+      for (uint8_t part = 0; part < parts; ++part) {
+        bound = distance[part] > bound ? distance[part] : bound;
+      }
+      if (bound == 0) {
+        for (uint8_t i = 0; i < depth; ++i) {
+          append_move(container, tw_path[i]);
+        }
+        return TW_PHASE_DONE;
+      }
+      bool expand = depth < tw_bound && ++tw_node_count <= THISTLETHWAITE_NODE_BUDGET;
+      tw_next_move[depth] = expand ? 0 : MOVE_COUNT;
+      if (tw_node_count >= node_limit) {
+        return TW_PHASE_RUNNING;
+      }
+    }
+
+    uint8_t remaining = tw_bound - depth;
+    while (tw_next_move[depth] < MOVE_COUNT && !tw_entering) {
+      uint8_t move = tw_next_move[depth]++;
+      if (!tw_move_allowed(phase, move) || skip_move(tw_path, depth, move)) {
+        continue;
+      }
+      tw_apply(move);
+      uint8_t* next = tw_distance[depth + 1];
+      uint8_t part = 0;
+      for (; part < parts; ++part) {
+        next[part] = tw_next_distance(distance[part], tw_distance_mod3(phase, part));
+        if (next[part] >= remaining) {
+          break;
+        }
+      }
+      if (part == parts) {
+        tw_path[depth] = move;
+        tw_depth = depth + 1;
+        tw_entering = true;
+      } else {
+        tw_apply(inverse_move(move));
+      }
+    }
+    if (tw_entering) {
+      continue;
+    }
+
+    if (depth > 0) {  // 이 노드의 회전을 다 해 봤으면 한 칸 되돌아갑니다.
+      tw_depth = depth - 1;
+      tw_apply(inverse_move(tw_path[tw_depth]));
+      continue;
+    }
+    if (tw_bound >= TW_SEARCH_DEPTH_LIMIT || tw_node_count > THISTLETHWAITE_NODE_BUDGET) {
+      return TW_PHASE_FAILED;
+    }
+    tw_bound++;  // 한도를 하나 늘려서 처음부터 다시 찾습니다.
+    tw_entering = true;
+  }
+}
+
+inline bool tw_solve_phase(uint8_t phase) {
+  uint8_t state = tw_phase_start(phase);
+  if (state == TW_PHASE_RUNNING) {
+    state = tw_phase_run(phase, 0xFFFFFFFF);
+  }
+  return state == TW_PHASE_DONE;
+}
+
+/* 4. 해법 구하기
+ *
+ * 전역 상태의 해법을 container에 저장하고 전역 상태를 맞춰진 상태로 만듭니다.
+ * Thistlethwaite 해법을 찾으면 true, 노드 예산을 넘기거나 잘못된 상태라서 solve()로 대신했으면 false를 반환합니다.
+ */
+inline void thistlethwaite_begin() {  // 탐색할 상태를 cube에서 풀어 놓습니다.
+  container.clear();
+  tw_node_count = 0;
+  cube.unpack(tw_corner_pos, tw_corner_ori, tw_edge_pos, tw_edge_ori);
+}
+inline void thistlethwaite_end() {  // 네 단계를 모두 마친 상태를 cube에 넣습니다.
+  cube = CubeState::pack(tw_corner_pos, tw_corner_ori, tw_edge_pos, tw_edge_ori);
+  optimize_moves(container);  // 단계 경계에서 이어지는 같은 축의 회전을 합칩니다.
+}
+inline bool thistlethwaite_solve() {
+  thistlethwaite_begin();
+  bool solved = true;
+  for (uint8_t phase = 0; phase < 4 && solved; ++phase) {
+    solved = tw_solve_phase(phase);
+  }
+  if (solved) {
+    thistlethwaite_end();
+    return true;
+  }
+  solve();
+  return false;
+}
+#endif  // !THISTLETHWAITE_NO_TABLES
+
+#endif  // !THISTLETHWAITE_H
@@ -0,0 +1,806 @@
+#ifndef THISTLETHWAITE_TABLES_H
+#define THISTLETHWAITE_TABLES_H
+
+// host/thistlethwaite_gen.cpp가 만든 파일입니다. 직접 고치지 말고 생성기를 다시 실행하세요.
+// 거리 표는 최소 회전 수 % 3을 2비트씩 저장합니다(3은 도달할 수 없는 좌표).
+
+constexpr uint8_t TW_TETRAD_MASK = 0xA5;
+constexpr uint16_t TW_M_SLICE_MASK = 0x505;
+constexpr uint16_t TW_PHASE3_SOLVED = 19369;
+
+// A 묶음 순서(순열 번호)를 자리 순서로 바꾸는 180도 회전 배치의 B 부분(순열 번호)
+const uint8_t tw_tetrad_relabel[24] PROGMEM = {
+  0, 1, 21, 15, 3, 5, 6, 7, 12, 18, 10, 8, 19, 13, 14, 20,
+  16, 22, 9, 11, 4, 2, 17, 23,
+};
+// 순열 번호 -> S4/V4 분류(0..5)
+const uint8_t tw_s4_class[24] PROGMEM = {
+  0, 1, 2, 3, 4, 5, 1, 0, 4, 5, 2, 3, 3, 2, 5, 4,
+  0, 1, 5, 4, 3, 2, 1, 0,
+};
+// 180도 회전 코너 배치의 corner_perm(정렬됨)
+const uint16_t tw_half_turn_corners[96] PROGMEM = {
+  0, 16, 414, 425, 702, 713, 1565, 1574, 1872, 1888, 2089, 2110, 2354, 2362, 2531, 2532,
+  2811, 2828, 3772, 3776, 4133, 4142, 4211, 4212, 10805, 10814, 11238, 11249, 11455, 11471, 11520, 11536,
+  11934, 11945, 12222, 12233, 12316, 12320, 12659, 12660, 12873, 12882, 13730, 13738, 14195, 14196, 14339, 14340,
+  25979, 25980, 26123, 26124, 26581, 26589, 27437, 27446, 27659, 27660, 27999, 28003, 28086, 28097, 28374, 28385,
+  28783, 28799, 28848, 28864, 29070, 29081, 29505, 29514, 36107, 36108, 36177, 36186, 36543, 36547, 37491, 37508,
+  37787, 37788, 37957, 37965, 38209, 38230, 38431, 38447, 38745, 38754, 39606, 39617, 39894, 39905, 40303, 40319,
+};
+// 1단계: flip
+const uint8_t tw_flip_distance[512] PROGMEM = {
+  32, 132, 65, 84, 65, 84, 65, 148, 80, 84, 81, 5, 86, 25, 165, 154,
+  80, 84, 86, 25, 21, 20, 105, 169, 5, 133, 90, 169, 150, 154, 168, 162,
+  81, 80, 25, 128, 17, 130, 105, 154, 100, 132, 130, 152, 148, 153, 149, 149,
+  32, 149, 84, 169, 66, 168, 85, 165, 96, 152, 70, 149, 70, 149, 106, 90,
+  132, 101, 80, 149, 84, 20, 130, 40, 84, 5, 132, 33, 25, 34, 153, 42,
+  20, 149, 153, 2, 132, 33, 154, 170, 160, 160, 154, 170, 153, 42, 162, 152,
+  100, 148, 66, 168, 148, 41, 152, 170, 133, 33, 152, 138, 25, 42, 153, 154,
+  68, 169, 25, 170, 153, 10, 89, 170, 153, 40, 89, 170, 169, 34, 134, 37,
+  81, 20, 32, 149, 100, 132, 66, 152, 17, 160, 96, 168, 133, 153, 70, 149,
+  145, 128, 69, 169, 160, 152, 70, 149, 90, 154, 85, 150, 89, 149, 106, 150,
+  138, 42, 165, 169, 165, 169, 100, 89, 150, 169, 101, 145, 101, 153, 69, 69,
+  150, 169, 101, 153, 101, 145, 5, 85, 100, 89, 20, 85, 84, 69, 34, 0,
+  100, 133, 68, 169, 148, 33, 153, 10, 133, 161, 153, 40, 145, 42, 154, 34,
+  96, 168, 145, 170, 152, 168, 89, 170, 152, 170, 89, 170, 153, 154, 74, 22,
+  25, 138, 101, 106, 169, 162, 153, 154, 169, 162, 90, 170, 162, 152, 154, 42,
+  101, 106, 25, 86, 105, 170, 69, 37, 153, 154, 69, 22, 154, 42, 25, 1,
+  132, 101, 80, 21, 84, 148, 130, 40, 84, 133, 132, 33, 25, 34, 154, 170,
+  20, 21, 153, 2, 132, 33, 153, 42, 160, 160, 153, 42, 154, 170, 98, 168,
+  96, 149, 148, 41, 130, 152, 152, 170, 132, 153, 25, 42, 153, 138, 153, 154,
+  133, 33, 153, 10, 24, 170, 89, 170, 145, 42, 169, 34, 153, 154, 134, 37,
+  101, 17, 148, 1, 20, 33, 169, 162, 5, 33, 137, 162, 170, 34, 153, 154,
+  133, 1, 170, 34, 137, 162, 89, 170, 169, 162, 89, 170, 153, 154, 68, 21,
+  148, 33, 169, 130, 41, 162, 170, 34, 33, 162, 162, 32, 162, 152, 26, 106,
+  169, 128, 98, 168, 162, 32, 154, 74, 162, 32, 154, 40, 146, 42, 26, 6,
+  36, 149, 148, 33, 132, 153, 25, 42, 160, 152, 144, 170, 153, 168, 153, 154,
+  133, 161, 153, 40, 145, 42, 154, 34, 152, 170, 89, 170, 153, 154, 74, 22,
+  25, 138, 169, 162, 169, 89, 89, 170, 169, 89, 169, 154, 89, 70, 133, 21,
+  169, 162, 98, 168, 154, 154, 154, 42, 89, 170, 154, 42, 73, 21, 21, 2,
+  133, 33, 169, 128, 33, 162, 162, 32, 161, 162, 162, 32, 162, 152, 26, 42,
+  169, 160, 98, 168, 162, 32, 154, 10, 170, 34, 154, 104, 146, 106, 41, 66,
+  138, 98, 106, 168, 162, 154, 26, 74, 162, 154, 40, 40, 32, 34, 34, 6,
+  106, 168, 168, 0, 160, 10, 42, 4, 146, 104, 42, 64, 34, 66, 2, 64,
+};
+// 2단계: twist
+const uint8_t tw_twist_distance[547] PROGMEM = {
+  160, 34, 162, 10, 129, 10, 34, 104, 97, 101, 170, 81, 22, 134, 9, 40,
+  25, 21, 86, 154, 26, 25, 41, 166, 145, 160, 21, 97, 8, 134, 32, 32,
+  34, 160, 162, 89, 165, 42, 164, 161, 42, 80, 25, 102, 164, 101, 150, 130,
+  162, 170, 34, 136, 34, 8, 152, 18, 10, 32, 16, 10, 2, 97, 160, 37,
+  166, 89, 89, 70, 32, 97, 128, 10, 10, 0, 168, 170, 168, 37, 130, 37,
+  138, 166, 42, 4, 42, 136, 168, 130, 166, 42, 170, 105, 36, 2, 152, 98,
+  2, 164, 162, 10, 105, 96, 34, 170, 34, 130, 16, 10, 18, 36, 0, 168,
+  154, 0, 130, 146, 18, 82, 8, 168, 38, 40, 81, 164, 41, 145, 22, 26,
+  170, 166, 138, 41, 130, 41, 74, 154, 40, 128, 2, 84, 130, 42, 166, 169,
+  166, 34, 170, 73, 26, 41, 148, 106, 153, 161, 136, 146, 5, 26, 168, 162,
+  170, 162, 41, 24, 162, 42, 40, 130, 34, 17, 169, 41, 138, 66, 26, 38,
+  134, 34, 132, 34, 170, 38, 146, 153, 41, 133, 9, 165, 36, 166, 168, 132,
+  168, 128, 8, 42, 166, 106, 170, 41, 166, 137, 152, 150, 136, 160, 6, 168,
+  32, 136, 106, 128, 42, 136, 161, 41, 137, 26, 136, 40, 90, 168, 170, 154,
+  134, 106, 34, 104, 162, 24, 4, 169, 138, 41, 145, 41, 22, 161, 74, 41,
+  154, 168, 88, 69, 0, 130, 0, 160, 170, 130, 170, 41, 166, 98, 168, 1,
+  130, 41, 169, 74, 20, 105, 137, 138, 169, 136, 169, 168, 34, 1, 129, 26,
+  40, 0, 136, 130, 130, 106, 34, 169, 16, 24, 6, 34, 137, 146, 4, 130,
+  98, 106, 40, 40, 160, 66, 170, 161, 128, 32, 8, 32, 18, 8, 42, 138,
+  166, 153, 169, 41, 164, 96, 170, 130, 129, 164, 161, 42, 82, 20, 40, 26,
+  170, 161, 10, 170, 145, 26, 138, 42, 134, 34, 170, 97, 162, 146, 148, 2,
+  138, 0, 26, 138, 24, 0, 152, 8, 169, 42, 25, 68, 34, 2, 106, 0,
+  10, 0, 32, 38, 34, 72, 8, 72, 162, 160, 153, 98, 2, 89, 25, 106,
+  165, 97, 137, 97, 160, 170, 32, 130, 18, 10, 41, 24, 32, 2, 162, 170,
+  170, 90, 166, 168, 34, 168, 162, 36, 170, 18, 4, 2, 105, 106, 152, 10,
+  33, 132, 162, 33, 169, 1, 26, 24, 0, 136, 0, 98, 146, 0, 2, 168,
+  18, 0, 170, 73, 170, 40, 24, 170, 144, 130, 162, 170, 34, 136, 34, 8,
+  18, 168, 0, 8, 154, 32, 65, 1, 10, 169, 130, 106, 25, 22, 165, 41,
+  130, 41, 160, 133, 34, 42, 168, 66, 10, 161, 34, 0, 8, 0, 34, 42,
+  16, 104, 146, 0, 10, 36, 34, 32, 146, 32, 16, 97, 152, 32, 18, 10,
+  144, 42, 32, 162, 170, 6, 145, 10, 10, 2, 16, 168, 64, 34, 146, 82,
+  40, 160, 38, 40, 138, 33, 10, 160, 166, 164, 134, 169, 154, 42, 148, 104,
+  17, 32, 2, 2, 40, 40, 40, 164, 138, 165, 32, 2, 153, 33, 162, 170,
+  154, 8, 26, 105, 32, 138, 152, 10, 128, 42, 42, 6, 4, 42, 6, 160,
+  160, 10, 0,
+};
+// 2단계: 가운데 층 엣지의 자리
+const uint8_t tw_slice_distance[124] PROGMEM = {
+  0, 80, 84, 16, 128, 85, 70, 148, 106, 80, 80, 21, 84, 105, 17, 169,
+  106, 9, 96, 144, 129, 164, 106, 144, 170, 170, 134, 144, 106, 149, 170, 70,
+  17, 72, 72, 82, 21, 72, 85, 85, 134, 82, 101, 80, 86, 85, 65, 170,
+  85, 169, 86, 153, 8, 96, 144, 129, 164, 106, 144, 170, 170, 134, 144, 106,
+  85, 170, 106, 149, 170, 85, 169, 86, 85, 20, 81, 170, 85, 169, 86, 150,
+  168, 170, 22, 20, 66, 161, 84, 22, 66, 85, 89, 97, 72, 21, 69, 85,
+  22, 84, 170, 149, 170, 102, 85, 84, 80, 85, 65, 84, 1, 5, 82, 106,
+  85, 68, 170, 86, 170, 102, 85, 164, 106, 170, 85, 38,
+};
+// 3단계: 코너 묶음과 순서 * 70 + 엣지 층
+const uint8_t tw_phase3_distance[7350] PROGMEM = {
+  168, 170, 10, 168, 42, 168, 160, 130, 170, 42, 42, 40, 160, 170, 128, 170,
+  170, 2, 74, 6, 10, 8, 10, 160, 128, 144, 69, 2, 40, 40, 40, 32,
+  130, 17, 40, 144, 41, 32, 130, 145, 0, 2, 40, 10, 168, 128, 128, 66,
+  6, 10, 8, 70, 146, 8, 0, 21, 136, 20, 84, 64, 1, 0, 4, 20,
+  85, 32, 82, 1, 0, 98, 1, 32, 82, 1, 64, 65, 5, 148, 8, 98,
+  64, 81, 5, 0, 21, 136, 0, 164, 85, 165, 149, 148, 149, 90, 74, 89,
+  101, 37, 150, 86, 86, 82, 105, 89, 150, 0, 8, 66, 2, 136, 0, 36,
+  16, 66, 72, 132, 17, 32, 66, 24, 8, 2, 96, 137, 130, 129, 5, 33,
+  138, 21, 18, 145, 153, 98, 150, 89, 152, 80, 85, 129, 138, 97, 148, 38,
+  65, 153, 74, 90, 34, 130, 85, 38, 133, 85, 164, 85, 150, 8, 148, 69,
+  21, 17, 69, 144, 89, 21, 68, 149, 85, 22, 69, 153, 37, 149, 4, 64,
+  85, 84, 81, 81, 4, 149, 85, 65, 72, 89, 102, 81, 152, 89, 18, 85,
+  160, 165, 101, 101, 169, 166, 85, 86, 102, 170, 170, 149, 154, 150, 169, 89,
+  169, 90, 162, 8, 32, 0, 33, 130, 6, 0, 138, 88, 72, 96, 132, 129,
+  20, 32, 134, 104, 85, 86, 85, 105, 105, 153, 165, 85, 105, 154, 153, 170,
+  101, 169, 154, 150, 166, 82, 166, 104, 138, 18, 132, 150, 90, 132, 164, 104,
+  166, 97, 161, 100, 86, 5, 41, 138, 0, 42, 32, 34, 104, 0, 162, 152,
+  4, 96, 66, 8, 64, 5, 162, 137, 162, 24, 32, 0, 34, 130, 6, 6,
+  74, 72, 0, 32, 133, 128, 20, 16, 138, 105, 68, 161, 154, 84, 1, 169,
+  104, 82, 6, 149, 90, 38, 166, 136, 165, 146, 164, 20, 132, 85, 17, 81,
+  16, 85, 38, 84, 69, 101, 101, 81, 133, 101, 22, 133, 32, 145, 133, 129,
+  85, 161, 136, 41, 150, 20, 88, 97, 150, 41, 24, 82, 16, 153, 101, 150,
+  149, 85, 105, 102, 105, 150, 165, 90, 86, 106, 170, 165, 166, 169, 170, 74,
+  65, 84, 21, 81, 5, 81, 101, 65, 73, 88, 86, 22, 89, 88, 38, 81,
+  20, 32, 32, 128, 129, 160, 0, 4, 25, 0, 64, 2, 17, 160, 96, 36,
+  128, 132, 96, 162, 85, 105, 86, 86, 170, 85, 138, 149, 136, 89, 70, 96,
+  132, 25, 1, 130, 16, 20, 0, 20, 4, 0, 65, 17, 1, 16, 20, 5,
+  88, 65, 85, 64, 0, 145, 146, 36, 134, 82, 9, 5, 165, 4, 100, 68,
+  149, 37, 97, 73, 36, 21, 165, 6, 96, 33, 41, 149, 68, 68, 149, 18,
+  37, 153, 152, 145, 164, 80, 82, 101, 4, 69, 81, 84, 69, 64, 81, 85,
+  81, 80, 85, 85, 148, 21, 85, 85, 20, 17, 80, 20, 69, 85, 20, 20,
+  85, 21, 5, 81, 85, 69, 89, 81, 85, 69, 80, 161, 170, 138, 170, 170,
+  168, 130, 42, 170, 10, 168, 162, 0, 168, 136, 130, 138, 128, 34, 41, 64,
+  64, 96, 129, 0, 8, 130, 72, 8, 33, 138, 132, 5, 36, 130, 170, 105,
+  85, 90, 90, 169, 105, 85, 149, 89, 170, 105, 154, 165, 169, 149, 90, 149,
+  146, 150, 152, 162, 82, 164, 170, 152, 133, 164, 41, 33, 82, 149, 86, 22,
+  16, 41, 166, 2, 5, 2, 18, 24, 128, 96, 132, 132, 16, 162, 136, 64,
+  0, 33, 168, 38, 42, 64, 2, 32, 133, 8, 40, 130, 72, 1, 33, 138,
+  8, 36, 96, 130, 42, 20, 145, 86, 134, 73, 90, 138, 146, 86, 149, 98,
+  34, 164, 152, 162, 146, 148, 0, 8, 64, 137, 0, 96, 4, 160, 2, 168,
+  4, 129, 0, 96, 22, 16, 2, 96, 80, 68, 104, 21, 102, 25, 90, 160,
+  84, 137, 5, 130, 22, 136, 102, 36, 165, 105, 154, 85, 90, 150, 170, 85,
+  165, 86, 154, 154, 89, 153, 170, 153, 169, 106, 73, 81, 144, 85, 97, 69,
+  89, 84, 81, 69, 152, 86, 20, 84, 88, 22, 97, 16, 16, 6, 153, 21,
+  85, 148, 69, 21, 86, 133, 105, 69, 65, 132, 85, 21, 5, 97, 146, 88,
+  26, 86, 82, 152, 101, 130, 149, 101, 161, 102, 65, 148, 22, 72, 162, 68,
+  20, 84, 85, 84, 22, 85, 81, 5, 85, 85, 5, 17, 81, 85, 69, 65,
+  145, 145, 100, 21, 145, 138, 21, 162, 133, 85, 144, 82, 9, 68, 41, 148,
+  20, 129, 150, 0, 37, 164, 69, 88, 38, 138, 82, 69, 41, 144, 80, 84,
+  21, 145, 165, 4, 68, 64, 16, 5, 97, 1, 17, 80, 16, 84, 20, 16,
+  0, 5, 81, 0, 4, 84, 20, 84, 85, 84, 22, 85, 81, 5, 81, 85,
+  5, 81, 81, 85, 69, 64, 33, 160, 170, 168, 42, 130, 128, 170, 162, 42,
+  138, 160, 136, 162, 138, 42, 130, 170, 80, 81, 84, 101, 97, 148, 69, 85,
+  81, 68, 105, 66, 81, 84, 89, 34, 81, 160, 106, 105, 153, 150, 166, 170,
+  85, 85, 170, 166, 105, 149, 90, 86, 90, 170, 89, 102, 36, 137, 166, 96,
+  150, 161, 5, 22, 20, 88, 42, 72, 85, 104, 81, 68, 8, 18, 69, 101,
+  22, 69, 89, 84, 21, 70, 149, 38, 20, 69, 84, 37, 21, 5, 32, 1,
+  96, 17, 40, 96, 8, 16, 8, 66, 4, 130, 128, 2, 148, 0, 128, 160,
+  0, 102, 105, 25, 84, 136, 101, 102, 5, 104, 81, 102, 90, 169, 17, 165,
+  137, 86, 148, 149, 84, 84, 150, 89, 69, 165, 21, 85, 102, 89, 81, 97,
+  101, 81, 41, 154, 38, 65, 146, 170, 25, 97, 168, 129, 96, 136, 154, 73,
+  38, 8, 96, 168, 86, 144, 5, 64, 84, 134, 64, 64, 100, 145, 89, 100,
+  72, 145, 73, 85, 80, 169, 170, 170, 162, 170, 138, 42, 170, 170, 170, 170,
+  138, 42, 170, 170, 168, 170, 170, 170, 170, 42, 170, 170, 168, 162, 170, 170,
+  170, 170, 168, 162, 170, 138, 170, 170, 90, 98, 64, 16, 37, 86, 4, 20,
+  17, 84, 149, 69, 69, 152, 88, 84, 149, 73, 85, 69, 16, 64, 85, 21,
+  17, 0, 64, 85, 85, 101, 85, 85, 85, 85, 85, 5, 0, 42, 168, 2,
+  16, 128, 160, 2, 6, 4, 0, 128, 0, 64, 0, 1, 0, 25, 97, 66,
+  166, 145, 40, 6, 166, 106, 98, 160, 68, 4, 34, 132, 170, 34, 162, 170,
+  149, 42, 152, 25, 64, 22, 34, 149, 41, 100, 86, 153, 168, 133, 33, 5,
+  154, 89, 101, 146, 42, 9, 168, 32, 82, 153, 74, 101, 85, 1, 106, 144,
+  154, 16, 25, 170, 88, 146, 137, 162, 104, 169, 34, 130, 8, 64, 32, 10,
+  136, 42, 34, 41, 136, 1, 33, 38, 72, 133, 34, 38, 41, 162, 144, 144,
+  130, 97, 134, 138, 101, 81, 86, 16, 82, 97, 69, 89, 88, 85, 82, 22,
+  149, 84, 72, 80, 89, 148, 86, 85, 153, 166, 101, 149, 153, 101, 85, 153,
+  105, 102, 85, 165, 105, 86, 150, 9, 97, 88, 20, 32, 1, 74, 146, 80,
+  90, 6, 0, 34, 132, 0, 96, 154, 4, 137, 1, 69, 129, 24, 69, 5,
+  17, 68, 101, 69, 82, 20, 38, 89, 149, 97, 102, 89, 149, 105, 86, 86,
+  153, 89, 86, 149, 153, 102, 86, 85, 153, 102, 101, 154, 97, 154, 72, 162,
+  160, 80, 0, 82, 34, 26, 105, 26, 129, 24, 130, 74, 162, 36, 85, 165,
+  69, 21, 37, 20, 36, 149, 101, 133, 65, 129, 69, 21, 165, 85, 133, 106,
+  85, 153, 86, 85, 149, 153, 102, 85, 153, 105, 102, 149, 149, 105, 86, 86,
+  154, 9, 1, 20, 153, 20, 69, 4, 5, 100, 25, 85, 81, 36, 86, 134,
+  85, 98, 16, 150, 96, 24, 18, 128, 70, 80, 161, 22, 32, 32, 96, 8,
+  4, 104, 73, 96, 86, 149, 105, 149, 85, 153, 105, 86, 149, 153, 102, 86,
+  105, 153, 102, 101, 149, 85, 1, 0, 68, 85, 149, 1, 4, 81, 85, 85,
+  69, 85, 85, 85, 85, 85, 5, 0, 8, 42, 2, 32, 128, 34, 138, 6,
+  4, 0, 64, 0, 64, 0, 1, 0, 136, 168, 154, 161, 8, 1, 152, 146,
+  168, 42, 10, 136, 98, 164, 2, 136, 68, 70, 162, 132, 168, 4, 85, 89,
+  148, 102, 165, 24, 168, 64, 168, 154, 73, 101, 166, 20, 72, 68, 90, 98,
+  149, 137, 104, 86, 168, 137, 129, 68, 38, 169, 84, 170, 138, 136, 42, 37,
+  138, 84, 64, 33, 138, 169, 38, 130, 40, 102, 96, 160, 73, 70, 33, 5,
+  0, 1, 33, 65, 0, 16, 1, 68, 0, 16, 132, 4, 4, 0, 133, 36,
+  97, 136, 65, 32, 101, 34, 73, 16, 10, 32, 73, 164, 134, 32, 24, 130,
+  132, 132, 81, 69, 82, 9, 16, 69, 97, 84, 170, 69, 2, 17, 101, 105,
+  152, 22, 82, 165, 85, 165, 165, 105, 85, 86, 102, 149, 90, 85, 153, 149,
+  150, 149, 165, 85, 149, 90, 101, 86, 86, 90, 85, 105, 86, 154, 85, 89,
+  89, 89, 89, 149, 90, 134, 145, 34, 162, 24, 137, 0, 130, 170, 64, 8,
+  129, 8, 100, 128, 16, 80, 6, 20, 133, 152, 37, 84, 4, 149, 37, 81,
+  69, 89, 101, 81, 69, 21, 21, 132, 97, 21, 84, 9, 18, 33, 138, 21,
+  82, 132, 153, 98, 150, 25, 21, 168, 20, 168, 105, 153, 166, 105, 102, 90,
+  105, 149, 170, 85, 90, 170, 169, 106, 101, 165, 165, 9, 10, 0, 24, 1,
+  2, 96, 2, 9, 0, 70, 152, 1, 72, 64, 2, 0, 10, 16, 69, 153,
+  37, 84, 4, 149, 21, 149, 133, 89, 101, 145, 68, 21, 21, 68, 97, 150,
+  84, 164, 97, 154, 89, 164, 2, 149, 89, 37, 82, 1, 154, 150, 73, 160,
+  68, 20, 85, 85, 80, 20, 84, 85, 5, 85, 85, 69, 25, 81, 84, 5,
+  81, 81, 81, 164, 80, 146, 66, 100, 84, 21, 165, 144, 73, 25, 38, 41,
+  9, 68, 161, 22, 37, 73, 36, 4, 80, 82, 74, 81, 97, 84, 85, 98,
+  164, 134, 144, 166, 68, 5, 81, 85, 5, 69, 65, 85, 69, 80, 85, 85,
+  148, 21, 69, 85, 16, 21, 4, 16, 80, 21, 80, 0, 68, 65, 0, 84,
+  20, 4, 24, 65, 64, 0, 65, 161, 40, 8, 40, 170, 162, 162, 42, 138,
+  138, 170, 34, 0, 130, 168, 170, 170, 168, 8, 72, 64, 18, 0, 0, 6,
+  25, 10, 74, 2, 25, 0, 0, 24, 0, 2, 162, 170, 106, 166, 166, 101,
+  86, 102, 106, 165, 105, 149, 166, 154, 150, 85, 166, 85, 82, 24, 21, 162,
+  20, 138, 152, 98, 21, 168, 21, 102, 25, 84, 129, 18, 133, 9, 81, 133,
+  101, 22, 4, 81, 101, 21, 133, 85, 102, 22, 133, 84, 17, 84, 5, 80,
+  73, 88, 102, 65, 16, 89, 22, 81, 84, 101, 101, 81, 84, 21, 65, 89,
+  32, 16, 96, 152, 153, 88, 154, 85, 102, 5, 134, 41, 70, 73, 153, 22,
+  102, 153, 34, 153, 64, 161, 160, 130, 0, 22, 34, 8, 0, 33, 133, 4,
+  2, 8, 130, 105, 21, 133, 100, 70, 72, 72, 169, 145, 98, 137, 166, 26,
+  165, 96, 106, 146, 164, 150, 166, 166, 106, 85, 150, 86, 106, 105, 101, 153,
+  166, 106, 106, 85, 85, 85, 42, 162, 24, 84, 8, 42, 136, 0, 33, 130,
+  8, 16, 66, 137, 161, 130, 32, 136, 34, 74, 64, 161, 160, 130, 0, 16,
+  18, 24, 72, 97, 132, 9, 2, 8, 130, 40, 105, 138, 88, 38, 9, 137,
+  104, 86, 73, 150, 154, 38, 81, 160, 105, 4, 150, 21, 85, 85, 68, 81,
+  5, 84, 68, 69, 85, 69, 100, 85, 69, 69, 84, 84, 4, 8, 8, 32,
+  130, 32, 34, 32, 2, 6, 4, 32, 64, 0, 64, 2, 1, 0, 153, 65,
+  8, 170, 153, 25, 129, 170, 106, 98, 129, 1, 0, 34, 149, 168, 34, 98,
+  165, 38, 41, 84, 86, 64, 17, 34, 165, 26, 161, 106, 134, 152, 105, 37,
+  10, 102, 105, 82, 82, 86, 5, 24, 32, 82, 170, 169, 169, 166, 2, 41,
+  85, 74, 144, 25, 42, 144, 154, 153, 17, 160, 169, 2, 128, 42, 0, 32,
+  10, 170, 42, 34, 168, 170, 42, 152, 170, 40, 162, 137, 170, 42, 166, 136,
+  162, 106, 130, 170, 170, 2, 82, 128, 86, 17, 86, 85, 90, 33, 65, 100,
+  150, 106, 6, 100, 37, 33, 4, 138, 32, 6, 168, 136, 168, 66, 138, 8,
+  34, 152, 16, 0, 162, 128, 137, 32, 10, 162, 8, 130, 32, 154, 34, 130,
+  32, 138, 32, 136, 104, 138, 32, 8, 162, 8, 32, 138, 32, 8, 162, 41,
+  34, 8, 162, 8, 130, 136, 166, 8, 130, 32, 138, 0, 81, 4, 21, 18,
+  17, 64, 33, 17, 69, 148, 80, 86, 69, 88, 1, 81, 4, 69, 69, 81,
+  84, 20, 5, 81, 20, 85, 20, 69, 101, 85, 21, 69, 81, 85, 5, 16,
+  0, 36, 32, 40, 130, 32, 8, 0, 8, 16, 64, 64, 8, 130, 128, 0,
+  168, 34, 82, 137, 106, 25, 138, 138, 25, 98, 129, 1, 0, 166, 160, 154,
+  5, 68, 150, 160, 153, 18, 82, 144, 17, 101, 73, 24, 161, 106, 106, 146,
+  66, 86, 170, 100, 133, 148, 2, 33, 5, 25, 96, 37, 104, 169, 170, 166,
+  102, 37, 84, 166, 138, 42, 162, 160, 170, 150, 97, 160, 152, 33, 138, 10,
+  0, 0, 8, 137, 153, 98, 85, 84, 20, 69, 69, 17, 20, 69, 81, 69,
+  81, 100, 85, 85, 81, 20, 85, 5, 32, 0, 8, 18, 160, 96, 0, 130,
+  0, 128, 32, 64, 128, 128, 1, 72, 0, 168, 34, 138, 168, 170, 37, 21,
+  152, 25, 34, 168, 2, 0, 4, 149, 152, 37, 6, 82, 8, 41, 84, 22,
+  129, 5, 86, 162, 84, 160, 106, 106, 90, 106, 101, 170, 32, 41, 144, 81,
+  101, 17, 152, 90, 150, 132, 1, 170, 166, 38, 41, 101, 165, 138, 42, 34,
+  132, 170, 90, 18, 168, 154, 33, 130, 24, 0, 160, 138, 168, 25, 64, 137,
+  146, 69, 137, 10, 2, 68, 152, 168, 81, 144, 137, 34, 25, 148, 169, 24,
+  21, 0, 64, 170, 1, 152, 162, 150, 2, 0, 104, 169, 104, 2, 164, 26,
+  0, 64, 68, 146, 89, 68, 70, 22, 149, 68, 164, 17, 97, 69, 25, 25,
+  81, 102, 24, 65, 4, 81, 68, 69, 0, 4, 84, 69, 16, 69, 69, 149,
+  17, 5, 85, 4, 17, 68, 16, 5, 85, 4, 64, 68, 69, 4, 17, 84,
+  85, 25, 81, 68, 69, 16, 65, 36, 153, 81, 100, 100, 17, 73, 69, 26,
+  21, 70, 148, 145, 81, 100, 134, 17, 81, 85, 17, 21, 21, 17, 17, 85,
+  84, 21, 81, 101, 85, 20, 81, 69, 69, 133, 0, 4, 24, 8, 168, 128,
+  0, 1, 9, 136, 0, 64, 0, 136, 0, 2, 0, 153, 1, 136, 168, 89,
+  37, 138, 138, 170, 98, 136, 0, 0, 162, 132, 168, 34, 98, 165, 102, 41,
+  84, 18, 81, 169, 102, 165, 26, 160, 106, 134, 148, 1, 33, 40, 102, 105,
+  90, 106, 22, 17, 89, 96, 86, 170, 5, 169, 166, 32, 41, 16, 74, 144,
+  25, 38, 149, 152, 85, 98, 129, 169, 6, 136, 10, 0, 32, 138, 168, 42,
+  34, 105, 152, 24, 102, 98, 72, 136, 82, 34, 40, 162, 148, 128, 146, 16,
+  128, 154, 164, 85, 69, 4, 150, 97, 5, 89, 21, 69, 85, 6, 149, 100,
+  9, 17, 85, 165, 102, 89, 153, 102, 85, 149, 153, 101, 90, 150, 105, 102,
+  149, 149, 105, 86, 85, 137, 101, 136, 0, 36, 1, 10, 146, 17, 74, 0,
+  16, 34, 164, 65, 17, 146, 5, 89, 37, 150, 69, 64, 69, 4, 145, 73,
+  162, 69, 85, 68, 22, 20, 153, 16, 100, 150, 165, 105, 86, 85, 153, 89,
+  102, 85, 153, 102, 86, 89, 153, 166, 85, 149, 85, 85, 85, 21, 64, 21,
+  17, 64, 85, 85, 85, 101, 85, 21, 1, 84, 69, 4, 16, 0, 4, 32,
+  16, 128, 160, 2, 0, 0, 16, 128, 64, 136, 10, 128, 34, 168, 34, 74,
+  136, 170, 40, 10, 22, 25, 34, 160, 65, 20, 166, 100, 144, 37, 6, 90,
+  16, 90, 18, 18, 160, 22, 153, 137, 41, 100, 86, 89, 161, 162, 106, 153,
+  40, 137, 161, 6, 33, 9, 168, 160, 42, 84, 74, 102, 149, 85, 38, 153,
+  149, 137, 42, 34, 128, 170, 138, 98, 104, 26, 33, 130, 8, 64, 32, 138,
+  165, 145, 98, 86, 22, 21, 86, 86, 150, 81, 101, 5, 149, 85, 100, 89,
+  89, 73, 69, 89, 41, 130, 6, 130, 153, 166, 41, 97, 40, 165, 96, 72,
+  154, 10, 24, 132, 97, 170, 70, 21, 149, 100, 6, 134, 65, 64, 5, 21,
+  89, 98, 24, 21, 0, 69, 25, 169, 170, 170, 138, 170, 138, 170, 170, 168,
+  170, 162, 170, 42, 170, 42, 170, 170, 170, 170, 170, 170, 168, 170, 168, 170,
+  138, 170, 42, 170, 170, 162, 170, 162, 170, 170, 90, 149, 88, 69, 2, 81,
+  84, 20, 96, 138, 145, 21, 69, 85, 5, 17, 38, 68, 17, 72, 64, 0,
+  16, 65, 4, 0, 82, 8, 0, 17, 68, 0, 16, 16, 66, 36, 96, 72,
+  130, 32, 105, 18, 73, 16, 74, 32, 137, 164, 129, 16, 36, 146, 132, 16,
+  68, 134, 128, 40, 8, 42, 8, 89, 36, 16, 130, 96, 0, 162, 144, 161,
+  146, 86, 90, 89, 85, 166, 149, 149, 85, 90, 85, 101, 149, 90, 102, 150,
+  86, 89, 165, 149, 149, 85, 101, 86, 106, 149, 165, 86, 85, 150, 153, 86,
+  165, 101, 149, 133, 26, 22, 105, 85, 4, 129, 20, 73, 37, 89, 100, 16,
+  104, 70, 146, 69, 17, 85, 85, 85, 21, 81, 149, 1, 68, 85, 85, 85,
+  69, 85, 21, 64, 84, 1, 4, 16, 0, 4, 168, 32, 128, 34, 2, 0,
+  0, 16, 64, 64, 168, 2, 128, 0, 137, 69, 106, 128, 9, 5, 25, 146,
+  72, 36, 34, 137, 162, 170, 37, 136, 168, 98, 150, 42, 169, 84, 86, 153,
+  136, 98, 102, 150, 40, 72, 104, 68, 26, 84, 8, 102, 101, 146, 105, 101,
+  149, 73, 25, 133, 170, 129, 2, 164, 36, 168, 98, 134, 144, 72, 6, 2,
+  170, 16, 64, 41, 138, 100, 160, 128, 40, 170, 154, 161, 136, 42, 165, 8,
+  42, 8, 38, 80, 6, 2, 138, 137, 105, 16, 161, 161, 36, 38, 138, 101,
+  89, 148, 81, 89, 37, 84, 36, 80, 85, 128, 81, 129, 85, 86, 100, 81,
+  150, 102, 85, 153, 102, 85, 149, 153, 166, 85, 169, 105, 102, 149, 85, 105,
+  86, 86, 73, 105, 8, 4, 96, 9, 72, 4, 17, 74, 0, 130, 2, 148,
+  102, 8, 146, 20, 149, 97, 82, 22, 4, 81, 69, 144, 24, 102, 81, 18,
+  85, 101, 20, 136, 1, 101, 86, 150, 105, 86, 85, 153, 105, 86, 149, 153,
+  102, 86, 89, 149, 102, 105, 149, 128, 40, 96, 1, 0, 8, 4, 32, 66,
+  136, 4, 17, 2, 64, 148, 128, 34, 32, 16, 100, 152, 154, 88, 154, 101,
+  98, 2, 70, 41, 70, 89, 148, 86, 101, 153, 22, 8, 150, 82, 24, 130,
+  146, 9, 17, 153, 25, 100, 25, 133, 41, 86, 149, 8, 145, 148, 89, 81,
+  68, 65, 21, 81, 84, 152, 86, 22, 133, 88, 85, 81, 20, 20, 69, 89,
+  21, 69, 20, 84, 17, 69, 136, 105, 101, 81, 133, 101, 17, 73, 161, 170,
+  86, 102, 105, 105, 85, 85, 102, 170, 170, 153, 170, 169, 169, 149, 165, 85,
+  34, 9, 64, 0, 40, 162, 32, 128, 130, 73, 8, 37, 132, 132, 68, 32,
+  146, 168, 97, 168, 149, 98, 5, 74, 138, 70, 104, 132, 166, 38, 65, 137,
+  102, 21, 165, 90, 86, 150, 105, 85, 154, 85, 85, 149, 166, 154, 170, 105,
+  170, 153, 165, 101, 41, 162, 0, 36, 128, 34, 138, 2, 42, 136, 5, 20,
+  70, 152, 64, 2, 34, 136, 34, 10, 65, 36, 40, 162, 32, 128, 66, 72,
+  8, 33, 148, 24, 4, 16, 130, 104, 85, 146, 104, 70, 0, 154, 138, 21,
+  22, 136, 86, 38, 134, 90, 41, 154, 134, 16, 149, 84, 102, 16, 20, 85,
+  81, 80, 84, 105, 102, 145, 68, 85, 82, 85, 80, 90, 89, 90, 102, 102,
+  165, 85, 149, 154, 166, 105, 170, 170, 102, 150, 106, 169, 86, 73, 153, 34,
+  145, 130, 144, 137, 69, 16, 25, 102, 153, 81, 41, 65, 161, 8, 85, 69,
+  85, 6, 65, 81, 21, 5, 73, 148, 102, 22, 69, 149, 37, 81, 9, 40,
+  0, 66, 25, 32, 8, 8, 16, 0, 64, 4, 18, 130, 4, 22, 8, 128,
+  98, 150, 85, 105, 37, 86, 170, 101, 138, 133, 73, 89, 70, 32, 136, 25,
+  65, 130, 64, 4, 5, 17, 16, 16, 0, 5, 1, 65, 69, 65, 9, 80,
+  16, 5, 80, 32, 21, 101, 84, 5, 132, 4, 162, 161, 97, 129, 150, 25,
+  101, 24, 88, 81, 104, 81, 105, 20, 168, 33, 72, 37, 10, 68, 100, 104,
+  148, 97, 97, 84, 21, 37, 73, 68, 81, 85, 65, 5, 81, 84, 21, 80,
+  85, 85, 148, 17, 85, 85, 20, 21, 84, 20, 85, 21, 84, 16, 69, 85,
+  1, 81, 85, 69, 89, 81, 85, 69, 80, 161, 168, 168, 42, 170, 170, 160,
+  170, 170, 10, 136, 32, 8, 128, 168, 162, 138, 138, 80, 0, 69, 80, 0,
+  22, 20, 21, 4, 4, 5, 64, 64, 64, 4, 5, 17, 144, 82, 84, 66,
+  146, 69, 102, 41, 148, 164, 164, 8, 33, 1, 85, 145, 69, 133, 134, 69,
+  85, 145, 148, 100, 145, 146, 17, 1, 138, 21, 130, 164, 66, 145, 86, 68,
+  5, 81, 85, 69, 101, 81, 85, 69, 64, 85, 81, 4, 21, 84, 85, 20,
+  21, 84, 20, 85, 85, 68, 22, 85, 85, 5, 84, 21, 69, 80, 65, 85,
+  69, 17, 33, 42, 170, 168, 34, 0, 130, 32, 2, 170, 170, 170, 160, 170,
+  138, 170, 162, 162, 80, 85, 88, 21, 97, 148, 153, 86, 81, 80, 84, 69,
+  65, 144, 89, 97, 69, 160, 150, 106, 153, 169, 170, 154, 166, 105, 106, 85,
+  165, 149, 153, 89, 90, 86, 90, 162, 20, 132, 86, 100, 150, 73, 70, 16,
+  37, 102, 32, 104, 132, 104, 22, 86, 137, 2, 32, 148, 16, 130, 132, 16,
+  1, 0, 4, 32, 32, 8, 100, 129, 0, 40, 96, 69, 88, 86, 81, 148,
+  153, 22, 97, 80, 84, 69, 65, 144, 85, 81, 85, 32, 24, 68, 38, 130,
+  16, 89, 22, 38, 37, 154, 165, 90, 137, 149, 86, 101, 153, 98, 136, 16,
+  33, 33, 129, 5, 18, 38, 40, 128, 160, 136, 2, 16, 0, 134, 168, 69,
+  149, 41, 22, 132, 169, 41, 145, 18, 41, 26, 10, 149, 104, 165, 146, 164,
+  150, 165, 101, 166, 154, 166, 106, 170, 105, 85, 85, 101, 90, 149, 102, 89,
+  89, 42, 130, 4, 16, 36, 22, 72, 32, 33, 129, 2, 8, 138, 40, 24,
+  65, 160, 136, 34, 136, 128, 1, 38, 145, 20, 80, 34, 168, 128, 162, 136,
+  2, 24, 0, 138, 40, 105, 138, 86, 42, 137, 89, 41, 66, 73, 37, 106,
+  10, 16, 153, 98, 88, 149, 128, 40, 96, 17, 0, 72, 4, 33, 18, 136,
+  0, 1, 2, 0, 148, 128, 34, 96, 150, 85, 105, 81, 22, 137, 22, 9,
+  152, 152, 101, 90, 98, 106, 146, 65, 128, 98, 85, 137, 38, 69, 150, 65,
+  102, 70, 4, 102, 40, 72, 82, 104, 9, 66, 73, 97, 68, 89, 82, 69,
+  89, 105, 34, 81, 68, 21, 20, 81, 84, 101, 81, 20, 20, 69, 85, 37,
+  82, 148, 149, 38, 21, 69, 84, 65, 17, 69, 101, 22, 70, 80, 165, 101,
+  165, 166, 166, 106, 166, 170, 154, 89, 85, 149, 150, 150, 89, 169, 170, 37,
+  138, 137, 161, 164, 68, 144, 38, 38, 10, 8, 89, 128, 9, 130, 10, 162,
+  101, 89, 148, 81, 89, 37, 84, 36, 80, 85, 128, 81, 129, 85, 86, 100,
+  81, 150, 86, 89, 153, 86, 101, 149, 153, 166, 86, 165, 105, 102, 85, 149,
+  105, 86, 149, 89, 64, 34, 20, 89, 85, 132, 69, 153, 36, 6, 81, 69,
+  16, 148, 133, 73, 86, 20, 134, 32, 153, 22, 128, 130, 0, 161, 68, 16,
+  33, 96, 9, 16, 32, 105, 97, 149, 150, 105, 85, 86, 153, 105, 102, 85,
+  153, 102, 86, 85, 153, 102, 89, 153, 1, 84, 17, 64, 85, 21, 85, 85,
+  85, 21, 1, 100, 85, 68, 85, 85, 85, 5, 32, 0, 168, 18, 16, 64,
+  0, 0, 0, 136, 40, 128, 160, 2, 1, 64, 0, 168, 34, 130, 165, 170,
+  40, 134, 136, 17, 98, 72, 6, 5, 38, 144, 26, 37, 6, 146, 137, 42,
+  24, 26, 128, 66, 170, 82, 100, 97, 86, 89, 105, 134, 89, 153, 32, 21,
+  164, 17, 41, 33, 40, 150, 153, 137, 34, 102, 149, 21, 106, 168, 150, 137,
+  42, 162, 100, 170, 138, 34, 160, 144, 33, 138, 22, 64, 160, 10, 8, 25,
+  98, 17, 72, 64, 0, 16, 65, 4, 0, 82, 8, 0, 17, 68, 0, 16,
+  16, 66, 36, 97, 136, 65, 32, 164, 33, 134, 16, 74, 16, 70, 152, 134,
+  32, 24, 146, 128, 168, 100, 160, 8, 144, 32, 72, 128, 81, 6, 130, 10,
+  130, 34, 32, 25, 65, 80, 86, 89, 90, 149, 102, 150, 85, 149, 90, 86,
+  169, 149, 89, 85, 86, 86, 90, 101, 149, 150, 153, 165, 86, 89, 85, 165,
+  85, 86, 86, 154, 85, 101, 165, 149, 70, 20, 101, 24, 153, 66, 144, 81,
+  134, 21, 70, 33, 4, 81, 149, 70, 73, 42, 86, 22, 21, 86, 86, 150,
+  81, 101, 5, 149, 85, 100, 89, 89, 73, 69, 89, 169, 154, 36, 65, 2,
+  106, 26, 146, 160, 133, 146, 132, 166, 105, 38, 8, 41, 136, 70, 22, 5,
+  64, 69, 146, 88, 70, 5, 21, 16, 36, 9, 153, 97, 69, 21, 169, 170,
+  170, 138, 170, 138, 170, 170, 168, 170, 162, 170, 42, 170, 42, 170, 170, 170,
+  170, 170, 170, 168, 170, 168, 170, 138, 170, 42, 170, 170, 162, 170, 162, 170,
+  170, 26, 129, 73, 4, 85, 21, 69, 101, 36, 154, 64, 81, 81, 4, 24,
+  85, 98, 85, 17, 85, 1, 68, 85, 149, 85, 85, 85, 21, 64, 68, 21,
+  64, 85, 85, 85, 133, 40, 0, 42, 18, 32, 64, 0, 0, 0, 168, 32,
+  64, 128, 0, 1, 64, 0, 137, 101, 144, 161, 73, 17, 164, 128, 72, 70,
+  9, 138, 162, 42, 18, 138, 168, 98, 86, 102, 152, 85, 86, 153, 161, 21,
+  168, 10, 42, 96, 72, 144, 74, 98, 40, 102, 169, 138, 74, 101, 149, 25,
+  104, 98, 102, 148, 10, 132, 132, 165, 4, 165, 144, 104, 164, 37, 138, 16,
+  0, 34, 136, 68, 154, 146, 40, 170, 42, 128, 136, 42, 97, 42, 64, 96,
+  40, 96, 161, 136, 130, 88, 40, 18, 146, 152, 73, 98, 146, 166, 85, 69,
+  4, 150, 97, 5, 89, 21, 69, 85, 6, 149, 100, 9, 17, 85, 165, 86,
+  85, 153, 102, 101, 149, 153, 102, 89, 154, 101, 102, 85, 149, 105, 86, 150,
+  25, 4, 102, 20, 148, 17, 85, 81, 138, 97, 70, 16, 81, 1, 81, 150,
+  88, 101, 80, 134, 68, 65, 26, 136, 4, 0, 161, 68, 134, 160, 64, 24,
+  0, 34, 89, 98, 85, 165, 105, 86, 86, 153, 105, 86, 149, 89, 102, 86,
+  85, 153, 166, 101, 153, 21, 21, 85, 68, 81, 149, 85, 68, 85, 81, 69,
+  68, 68, 69, 69, 84, 85, 4, 0, 8, 32, 2, 16, 0, 32, 2, 6,
+  4, 32, 160, 2, 66, 2, 1, 32, 136, 168, 34, 161, 8, 0, 32, 146,
+  168, 42, 42, 138, 85, 166, 34, 2, 100, 6, 161, 4, 104, 8, 154, 106,
+  80, 170, 149, 9, 101, 68, 148, 169, 165, 105, 153, 40, 72, 64, 22, 146,
+  169, 10, 164, 90, 153, 106, 69, 132, 21, 104, 153, 90, 137, 136, 170, 34,
+  138, 0, 0, 42, 2, 169, 38, 148, 88, 101, 98, 133, 73, 102, 69, 162,
+  102, 65, 134, 40, 102, 80, 164, 98, 18, 1, 0, 42, 22, 101, 40, 22,
+  0, 64, 170, 1, 152, 162, 150, 2, 0, 104, 169, 104, 2, 164, 26, 0,
+  64, 68, 146, 89, 68, 70, 22, 149, 68, 164, 17, 97, 69, 25, 25, 81,
+  102, 24, 65, 4, 81, 17, 69, 100, 85, 21, 68, 16, 81, 17, 1, 16,
+  85, 80, 4, 17, 68, 16, 85, 80, 68, 86, 81, 81, 4, 81, 21, 16,
+  0, 81, 17, 69, 16, 65, 36, 153, 81, 100, 100, 17, 73, 69, 26, 21,
+  70, 148, 145, 81, 100, 134, 17, 85, 69, 81, 84, 85, 149, 81, 20, 85,
+  20, 69, 65, 20, 21, 69, 81, 81, 5, 16, 2, 36, 32, 16, 128, 32,
+  0, 32, 8, 144, 160, 64, 8, 2, 128, 0, 137, 101, 98, 5, 1, 0,
+  168, 130, 72, 102, 66, 133, 165, 170, 34, 138, 168, 162, 90, 89, 104, 152,
+  154, 170, 64, 18, 150, 165, 38, 68, 89, 69, 6, 104, 8, 170, 89, 169,
+  165, 169, 169, 10, 21, 138, 149, 80, 66, 148, 21, 104, 32, 133, 16, 64,
+  166, 34, 170, 0, 64, 34, 136, 100, 170, 66, 88, 170, 42, 129, 136, 42,
+  85, 85, 20, 69, 85, 149, 21, 69, 81, 69, 81, 4, 69, 81, 81, 20,
+  21, 5, 32, 32, 8, 18, 16, 64, 0, 2, 0, 130, 32, 136, 130, 128,
+  1, 64, 0, 1, 101, 170, 160, 9, 0, 36, 148, 72, 38, 42, 74, 150,
+  42, 86, 136, 168, 162, 154, 21, 88, 153, 154, 170, 106, 41, 88, 9, 100,
+  80, 72, 128, 22, 82, 25, 170, 149, 129, 134, 169, 169, 74, 36, 97, 89,
+  68, 6, 133, 132, 102, 10, 150, 145, 104, 38, 6, 2, 0, 0, 42, 138,
+  100, 162, 144, 100, 169, 170, 160, 136, 42, 168, 170, 42, 152, 170, 40, 162,
+  137, 170, 42, 166, 136, 162, 106, 130, 170, 170, 2, 129, 132, 149, 1, 153,
+  106, 153, 17, 132, 84, 90, 85, 73, 84, 41, 80, 8, 138, 32, 38, 160,
+  8, 64, 96, 130, 8, 34, 26, 168, 34, 162, 2, 137, 32, 10, 162, 8,
+  130, 32, 154, 34, 130, 32, 138, 32, 136, 104, 138, 32, 8, 162, 8, 32,
+  138, 32, 8, 162, 41, 34, 8, 162, 8, 130, 136, 166, 8, 130, 32, 138,
+  0, 81, 4, 84, 18, 85, 89, 96, 17, 69, 132, 20, 64, 68, 72, 5,
+  81, 4, 81, 81, 17, 21, 85, 149, 17, 85, 21, 21, 81, 1, 85, 20,
+  81, 85, 69, 5, 0, 4, 24, 0, 16, 128, 0, 1, 9, 136, 128, 136,
+  32, 136, 0, 2, 2, 136, 168, 98, 133, 8, 0, 36, 148, 152, 170, 42,
+  68, 102, 166, 10, 18, 100, 6, 161, 85, 104, 128, 154, 106, 106, 170, 133,
+  8, 36, 80, 149, 133, 133, 105, 153, 160, 88, 105, 38, 146, 169, 74, 164,
+  90, 136, 68, 1, 149, 21, 104, 152, 90, 137, 136, 170, 10, 138, 0, 128,
+  42, 0, 168, 166, 64, 100, 102, 106, 128, 74, 102, 38, 8, 2, 8, 33,
+  133, 4, 0, 130, 72, 9, 32, 168, 160, 20, 96, 134, 168, 97, 152, 154,
+  160, 69, 170, 41, 150, 104, 164, 22, 18, 18, 153, 33, 69, 149, 90, 85,
+  85, 149, 154, 170, 105, 150, 149, 150, 90, 105, 89, 149, 170, 169, 105, 41,
+  130, 32, 128, 96, 18, 73, 33, 36, 132, 4, 0, 130, 10, 74, 1, 161,
+  136, 34, 8, 130, 74, 98, 129, 4, 32, 130, 72, 0, 34, 168, 32, 21,
+  36, 138, 104, 9, 145, 166, 80, 132, 105, 106, 25, 86, 153, 34, 6, 134,
+  89, 34, 154, 134, 8, 8, 64, 2, 0, 64, 6, 24, 10, 74, 6, 9,
+  0, 64, 24, 16, 2, 82, 165, 89, 101, 105, 170, 105, 149, 166, 149, 154,
+  89, 153, 165, 169, 153, 170, 170, 38, 69, 40, 84, 65, 150, 73, 165, 66,
+  149, 104, 34, 74, 161, 72, 69, 82, 8, 101, 65, 84, 21, 69, 89, 89,
+  21, 69, 148, 101, 4, 65, 153, 37, 97, 5, 80, 21, 68, 21, 82, 148,
+  153, 85, 82, 84, 89, 69, 16, 148, 89, 82, 69, 96, 150, 73, 105, 22,
+  22, 137, 38, 9, 149, 89, 101, 90, 98, 102, 146, 64, 128, 84, 4, 85,
+  81, 68, 22, 85, 85, 5, 85, 85, 65, 81, 80, 85, 69, 17, 161, 20,
+  1, 134, 134, 73, 22, 102, 160, 69, 85, 145, 17, 104, 88, 160, 81, 84,
+  161, 105, 32, 169, 145, 88, 85, 145, 84, 20, 90, 88, 0, 129, 17, 134,
+  69, 73, 65, 0, 1, 65, 36, 16, 20, 21, 0, 65, 17, 0, 5, 84,
+  5, 4, 16, 84, 4, 85, 81, 84, 22, 85, 85, 5, 81, 85, 65, 81,
+  80, 85, 69, 80, 161, 162, 170, 170, 34, 8, 128, 168, 42, 42, 138, 170,
+  168, 168, 138, 2, 130, 162, 36, 65, 69, 21, 85, 148, 85, 22, 85, 132,
+  101, 5, 81, 129, 101, 34, 69, 161, 66, 161, 66, 69, 102, 153, 104, 38,
+  81, 72, 37, 138, 68, 8, 86, 65, 149, 166, 165, 149, 149, 170, 166, 90,
+  90, 165, 106, 149, 86, 154, 153, 166, 105, 150, 70, 17, 84, 84, 17, 70,
+  89, 101, 82, 86, 84, 86, 16, 21, 88, 102, 81, 4, 160, 0, 128, 1,
+  33, 64, 38, 145, 0, 96, 128, 9, 128, 64, 36, 0, 160, 160, 16, 102,
+  105, 10, 84, 136, 85, 102, 5, 168, 81, 102, 154, 164, 81, 97, 153, 33,
+  5, 0, 1, 33, 65, 0, 16, 1, 68, 0, 16, 132, 4, 4, 0, 133,
+  36, 33, 72, 130, 32, 169, 17, 134, 0, 74, 16, 134, 152, 133, 16, 36,
+  146, 132, 72, 105, 146, 150, 69, 4, 24, 165, 90, 145, 20, 69, 0, 86,
+  24, 85, 36, 145, 165, 86, 101, 101, 101, 101, 85, 166, 149, 105, 85, 165,
+  149, 149, 89, 165, 86, 85, 90, 86, 150, 86, 102, 85, 165, 86, 153, 149,
+  85, 105, 90, 90, 85, 90, 5, 89, 64, 32, 144, 1, 34, 4, 18, 160,
+  42, 8, 32, 70, 162, 136, 104, 36, 85, 85, 85, 85, 85, 21, 85, 85,
+  85, 4, 1, 100, 85, 21, 1, 0, 84, 5, 0, 4, 16, 0, 16, 0,
+  0, 1, 41, 138, 40, 128, 0, 136, 10, 2, 0, 25, 33, 2, 168, 145,
+  40, 2, 138, 170, 98, 104, 2, 4, 162, 100, 170, 34, 162, 170, 21, 106,
+  152, 17, 66, 98, 42, 149, 41, 98, 86, 137, 165, 17, 33, 20, 154, 89,
+  97, 166, 42, 1, 42, 36, 90, 153, 22, 101, 85, 16, 42, 18, 138, 17,
+  25, 166, 144, 144, 137, 34, 136, 169, 38, 138, 20, 80, 33, 138, 133, 42,
+  34, 161, 24, 42, 72, 34, 68, 154, 70, 138, 88, 8, 80, 160, 160, 24,
+  98, 154, 36, 85, 165, 69, 21, 37, 20, 36, 149, 101, 133, 65, 129, 69,
+  21, 165, 85, 133, 90, 89, 153, 102, 101, 149, 153, 102, 86, 149, 105, 102,
+  85, 85, 105, 86, 149, 10, 97, 41, 16, 32, 9, 8, 8, 148, 74, 5,
+  145, 2, 132, 36, 9, 150, 4, 137, 85, 146, 149, 24, 69, 85, 100, 25,
+  80, 16, 81, 20, 102, 20, 64, 96, 102, 149, 149, 105, 150, 86, 153, 105,
+  102, 85, 153, 102, 86, 101, 149, 102, 85, 153, 37, 42, 153, 36, 104, 96,
+  160, 136, 134, 137, 40, 21, 130, 137, 4, 36, 130, 102, 81, 86, 16, 82,
+  97, 69, 89, 88, 85, 82, 22, 149, 84, 72, 80, 89, 148, 102, 89, 153,
+  166, 85, 149, 153, 102, 86, 149, 101, 102, 149, 165, 105, 86, 85, 153, 73,
+  86, 101, 152, 20, 133, 81, 89, 17, 68, 80, 81, 36, 66, 81, 64, 98,
+  16, 166, 9, 0, 18, 136, 0, 144, 165, 5, 134, 161, 64, 8, 20, 37,
+  73, 96, 154, 149, 105, 86, 85, 153, 105, 102, 85, 89, 102, 86, 89, 153,
+  102, 85, 150, 85, 85, 85, 85, 85, 149, 85, 85, 21, 0, 64, 68, 85,
+  21, 64, 16, 85, 5, 0, 4, 16, 0, 32, 0, 0, 1, 9, 168, 32,
+  64, 0, 168, 130, 10, 0, 136, 168, 42, 129, 8, 17, 161, 144, 152, 170,
+  9, 137, 98, 164, 25, 152, 68, 6, 166, 6, 169, 64, 85, 89, 161, 102,
+  133, 8, 42, 96, 168, 134, 89, 101, 166, 80, 72, 82, 42, 102, 149, 25,
+  104, 86, 136, 148, 1, 100, 38, 168, 86, 170, 138, 136, 42, 2, 138, 16,
+  0, 34, 136, 168, 150, 162, 40, 102, 88, 162, 74, 70, 86, 148, 149, 84,
+  84, 150, 89, 69, 165, 21, 85, 102, 89, 81, 97, 101, 81, 169, 146, 0,
+  130, 25, 102, 42, 146, 32, 164, 146, 68, 166, 106, 24, 132, 105, 138, 86,
+  80, 21, 102, 20, 146, 81, 102, 148, 17, 16, 32, 89, 17, 0, 101, 80,
+  169, 170, 170, 162, 170, 138, 42, 170, 170, 170, 170, 138, 42, 170, 170, 168,
+  170, 170, 170, 170, 42, 170, 170, 168, 162, 170, 170, 170, 170, 168, 162, 170,
+  138, 170, 170, 26, 102, 85, 81, 98, 18, 21, 101, 85, 65, 68, 1, 81,
+  137, 69, 16, 144, 88, 80, 132, 88, 86, 81, 20, 152, 22, 81, 84, 21,
+  101, 145, 148, 85, 81, 84, 80, 166, 90, 90, 89, 106, 149, 166, 169, 90,
+  85, 165, 170, 105, 105, 150, 150, 170, 18, 81, 148, 82, 21, 130, 90, 66,
+  65, 9, 165, 100, 153, 160, 41, 134, 145, 9, 2, 0, 22, 128, 2, 130,
+  16, 129, 32, 4, 32, 9, 40, 68, 9, 64, 8, 80, 84, 88, 21, 81,
+  20, 152, 86, 145, 84, 21, 101, 81, 148, 89, 81, 132, 32, 166, 69, 164,
+  86, 154, 89, 148, 2, 149, 153, 37, 82, 65, 150, 150, 9, 160, 20, 20,
+  85, 85, 68, 4, 85, 85, 5, 85, 84, 69, 89, 81, 85, 65, 17, 33,
+  68, 97, 129, 22, 1, 86, 104, 80, 37, 165, 72, 37, 106, 68, 149, 97,
+  100, 161, 101, 68, 85, 81, 96, 128, 22, 85, 40, 138, 89, 18, 165, 129,
+  5, 96, 73, 1, 81, 85, 69, 69, 80, 85, 69, 80, 69, 85, 148, 21,
+  85, 21, 20, 21, 16, 0, 69, 80, 0, 4, 20, 21, 4, 5, 68, 64,
+  73, 80, 4, 1, 17, 160, 42, 136, 42, 170, 40, 162, 32, 138, 170, 168,
+  42, 32, 136, 170, 162, 170, 128, 0, 72, 64, 153, 0, 32, 4, 161, 2,
+  168, 0, 145, 0, 32, 22, 0, 2, 160, 133, 145, 41, 66, 41, 8, 37,
+  86, 161, 80, 74, 150, 73, 149, 18, 81, 144, 150, 170, 102, 166, 106, 86,
+  102, 106, 90, 169, 85, 165, 106, 89, 90, 101, 154, 70, 80, 84, 85, 18,
+  65, 81, 105, 82, 149, 84, 81, 22, 85, 84, 102, 144, 4, 4, 73, 148,
+  37, 21, 20, 149, 38, 81, 69, 21, 101, 81, 73, 85, 6, 69, 161, 24,
+  66, 105, 17, 148, 169, 148, 101, 37, 152, 101, 82, 88, 73, 90, 98, 152,
+  42, 136, 1, 37, 33, 138, 4, 18, 34, 8, 2, 32, 148, 16, 16, 128,
+  134, 104, 85, 106, 165, 166, 101, 154, 166, 90, 102, 85, 149, 166, 86, 90,
+  90, 149, 166, 70, 64, 89, 105, 85, 136, 132, 166, 33, 101, 162, 170, 81,
+  168, 104, 98, 105, 168, 130, 9, 24, 32, 162, 72, 64, 33, 130, 40, 32,
+  82, 8, 128, 1, 168, 152, 42, 72, 0, 1, 34, 138, 4, 18, 18, 9,
+  2, 36, 132, 128, 80, 128, 154, 104, 97, 168, 104, 162, 129, 152, 104, 85,
+  105, 40, 90, 26, 38, 89, 105, 68, 129, 4, 16, 80, 21, 84, 2, 69,
+  65, 0, 68, 20, 4, 0, 65, 1, 64, 65, 160, 69, 133, 17, 150, 132,
+  101, 21, 145, 1, 161, 5, 5, 86, 40, 137, 97, 104, 145, 85, 88, 160,
+  97, 100, 98, 134, 69, 104, 21, 17, 97, 133, 134, 148, 0, 73, 5, 81,
+  85, 69, 101, 81, 85, 69, 80, 84, 85, 20, 20, 85, 81, 20, 5, 68,
+  20, 85, 85, 84, 22, 85, 85, 5, 69, 85, 69, 1, 81, 21, 69, 81,
+  32, 32, 42, 40, 162, 2, 160, 168, 2, 170, 138, 42, 168, 162, 170, 42,
+  170, 170, 32, 69, 153, 37, 85, 148, 149, 21, 85, 129, 89, 69, 80, 68,
+  84, 37, 65, 97, 70, 80, 72, 130, 102, 153, 84, 66, 97, 137, 38, 162,
+  84, 37, 36, 101, 132, 170, 170, 166, 169, 165, 154, 90, 89, 170, 101, 153,
+  150, 153, 86, 101, 101, 153, 5, 18, 2, 24, 9, 10, 68, 128, 1, 0,
+  100, 16, 0, 10, 66, 2, 8, 8, 20, 69, 152, 37, 101, 148, 149, 37,
+  97, 65, 89, 69, 80, 69, 84, 21, 65, 33, 8, 68, 38, 145, 16, 89,
+  38, 98, 37, 90, 165, 90, 89, 153, 86, 165, 152, 34, 137, 64, 33, 36,
+  145, 16, 82, 34, 10, 0, 41, 136, 4, 128, 0, 162, 168, 105, 105, 170,
+  150, 165, 106, 102, 154, 86, 165, 101, 150, 150, 86, 85, 89, 149, 6, 85,
+  153, 161, 148, 164, 153, 162, 33, 81, 106, 41, 65, 40, 154, 162, 89, 104,
+  162, 4, 20, 2, 82, 8, 0, 33, 161, 144, 144, 130, 136, 0, 8, 36,
+  138, 98, 138, 80, 1, 32, 129, 9, 16, 38, 138, 0, 41, 136, 8, 168,
+  0, 162, 168, 97, 168, 37, 162, 137, 89, 106, 5, 89, 152, 162, 6, 84,
+  97, 170, 20, 145, 0, 8, 66, 18, 136, 64, 36, 17, 18, 72, 128, 1,
+  32, 2, 24, 8, 2, 32, 84, 85, 96, 82, 102, 153, 104, 102, 68, 72,
+  37, 138, 4, 37, 36, 40, 150, 98, 89, 165, 81, 37, 133, 89, 37, 136,
+  88, 26, 106, 22, 132, 105, 145, 36, 10, 85, 132, 101, 38, 69, 153, 101,
+  33, 65, 85, 86, 16, 69, 69, 21, 85, 1, 16, 86, 88, 102, 81, 148,
+  85, 86, 17, 84, 101, 6, 81, 68, 84, 81, 22, 80, 170, 86, 166, 102,
+  105, 106, 165, 170, 154, 89, 89, 165, 169, 150, 149, 165, 165, 168, 170, 42,
+  160, 170, 128, 130, 138, 170, 42, 168, 160, 130, 170, 2, 170, 170, 130, 66,
+  36, 136, 128, 130, 130, 2, 24, 101, 32, 160, 0, 10, 2, 10, 25, 10,
+  24, 9, 2, 10, 25, 40, 32, 160, 2, 138, 2, 8, 96, 36, 136, 128,
+  102, 16, 0, 34, 84, 0, 80, 69, 1, 137, 32, 22, 80, 65, 1, 64,
+  133, 8, 64, 137, 0, 64, 133, 8, 85, 20, 16, 0, 64, 1, 21, 20,
+  34, 84, 0, 32, 102, 89, 150, 86, 88, 89, 105, 137, 149, 85, 22, 90,
+  106, 101, 97, 165, 85, 165,
+};
+// 4단계: 코너 * 24 + 층(M, S, E) 하나의 엣지 순서
+const uint8_t tw_corner_layer_distance[3][576] PROGMEM = {
+  {
+    160, 2, 170, 138, 168, 42, 86, 161, 81, 69, 73, 101, 96, 129, 97, 73,
+    74, 105, 9, 90, 10, 160, 164, 0, 137, 88, 136, 34, 32, 18, 73, 169,
+    69, 97, 86, 145, 96, 129, 105, 73, 98, 73, 102, 145, 97, 73, 66, 137,
+    105, 100, 102, 153, 25, 105, 9, 42, 2, 144, 153, 32, 144, 1, 129, 70,
+    64, 2, 9, 106, 138, 160, 169, 98, 26, 168, 8, 32, 42, 164, 37, 89,
+    169, 106, 101, 88, 80, 2, 82, 129, 128, 1, 41, 101, 37, 90, 89, 106,
+    65, 65, 97, 73, 65, 73, 130, 130, 66, 129, 130, 129, 101, 88, 106, 41,
+    165, 89, 98, 133, 97, 89, 66, 137, 130, 130, 129, 66, 66, 130, 82, 69,
+    89, 101, 98, 69, 137, 104, 136, 162, 169, 98, 137, 40, 132, 18, 9, 34,
+    102, 145, 97, 73, 66, 137, 96, 129, 105, 73, 98, 73, 128, 1, 145, 66,
+    64, 6, 137, 106, 10, 162, 169, 96, 105, 102, 100, 25, 153, 105, 9, 38,
+    6, 160, 137, 32, 90, 145, 81, 69, 73, 101, 161, 130, 170, 138, 169, 42,
+    133, 104, 136, 34, 36, 2, 74, 41, 69, 97, 84, 81, 98, 1, 97, 73,
+    73, 169, 5, 106, 10, 160, 160, 16, 98, 129, 101, 73, 82, 137, 101, 90,
+    104, 169, 37, 89, 137, 104, 136, 162, 169, 98, 137, 40, 132, 18, 9, 34,
+    130, 129, 130, 66, 66, 130, 82, 65, 81, 69, 98, 69, 165, 89, 41, 104,
+    101, 90, 10, 168, 24, 36, 42, 160, 97, 65, 65, 73, 65, 73, 66, 130,
+    130, 129, 130, 129, 80, 2, 82, 129, 128, 1, 41, 101, 37, 90, 89, 106,
+    169, 101, 165, 88, 89, 104, 64, 2, 66, 133, 128, 5, 66, 130, 66, 129,
+    130, 130, 97, 65, 97, 73, 65, 65, 26, 168, 8, 32, 42, 164, 37, 89,
+    169, 106, 101, 88, 82, 65, 89, 69, 66, 69, 130, 129, 129, 66, 130, 130,
+    137, 36, 128, 34, 25, 34, 137, 106, 138, 34, 41, 98, 101, 90, 104, 169,
+    37, 89, 98, 129, 101, 73, 82, 137, 5, 106, 10, 160, 160, 16, 98, 1,
+    97, 73, 73, 169, 73, 169, 69, 97, 86, 145, 137, 88, 136, 34, 32, 18,
+    162, 66, 170, 138, 169, 106, 82, 129, 81, 69, 73, 69, 9, 42, 2, 144,
+    153, 32, 105, 100, 102, 153, 25, 105, 137, 106, 10, 162, 169, 96, 128, 1,
+    145, 66, 64, 6, 98, 65, 105, 73, 96, 137, 98, 129, 97, 73, 70, 153,
+    137, 36, 128, 34, 25, 34, 137, 106, 138, 34, 41, 98, 82, 73, 89, 85,
+    98, 69, 130, 129, 129, 130, 66, 130, 98, 133, 97, 89, 66, 137, 101, 88,
+    106, 41, 165, 89, 66, 130, 66, 130, 130, 129, 97, 65, 97, 65, 65, 73,
+    169, 101, 165, 88, 89, 104, 64, 2, 66, 133, 128, 5, 165, 89, 41, 104,
+    101, 90, 10, 168, 24, 36, 42, 160, 9, 106, 138, 160, 169, 98, 144, 1,
+    129, 70, 64, 2, 9, 38, 6, 160, 137, 32, 105, 102, 100, 25, 153, 105,
+    98, 129, 97, 73, 70, 153, 98, 65, 105, 73, 96, 137, 74, 41, 69, 97,
+    84, 81, 133, 104, 136, 34, 36, 2, 9, 90, 10, 160, 164, 0, 96, 129,
+    97, 73, 74, 105, 82, 129, 81, 69, 65, 101, 161, 66, 170, 138, 170, 42,
+  },
+  {
+    160, 2, 170, 138, 168, 42, 86, 161, 81, 69, 73, 101, 65, 65, 97, 73,
+    65, 73, 130, 130, 66, 129, 130, 129, 130, 130, 129, 66, 66, 130, 82, 69,
+    89, 101, 98, 69, 96, 129, 105, 73, 98, 73, 102, 145, 97, 73, 66, 137,
+    137, 104, 136, 162, 169, 98, 137, 40, 132, 18, 9, 34, 80, 2, 82, 129,
+    128, 1, 41, 101, 37, 90, 89, 106, 98, 133, 97, 89, 66, 137, 101, 88,
+    106, 41, 165, 89, 144, 1, 129, 70, 64, 2, 9, 106, 138, 160, 169, 98,
+    96, 129, 97, 73, 74, 105, 9, 90, 10, 160, 164, 0, 37, 89, 169, 106,
+    101, 88, 26, 168, 8, 32, 42, 164, 137, 88, 136, 34, 32, 18, 73, 169,
+    69, 97, 86, 145, 105, 100, 102, 153, 25, 105, 9, 42, 2, 144, 153, 32,
+    102, 145, 97, 73, 66, 137, 96, 129, 105, 73, 98, 73, 80, 2, 82, 129,
+    128, 1, 41, 101, 37, 90, 89, 106, 137, 104, 136, 162, 169, 98, 137, 40,
+    132, 18, 9, 34, 90, 145, 81, 69, 73, 101, 161, 130, 170, 138, 169, 42,
+    130, 129, 130, 66, 66, 130, 82, 65, 81, 69, 98, 69, 97, 65, 65, 73,
+    65, 73, 66, 130, 130, 129, 130, 129, 10, 168, 24, 36, 42, 160, 165, 89,
+    41, 104, 101, 90, 105, 102, 100, 25, 153, 105, 9, 38, 6, 160, 137, 32,
+    133, 104, 136, 34, 36, 2, 74, 41, 69, 97, 84, 81, 101, 90, 104, 169,
+    37, 89, 98, 129, 101, 73, 82, 137, 98, 1, 97, 73, 73, 169, 5, 106,
+    10, 160, 160, 16, 128, 1, 145, 66, 64, 6, 137, 106, 10, 162, 169, 96,
+    9, 106, 138, 160, 169, 98, 144, 1, 129, 70, 64, 2, 9, 90, 10, 160,
+    164, 0, 96, 129, 97, 73, 74, 105, 98, 133, 97, 89, 66, 137, 101, 88,
+    106, 41, 165, 89, 74, 41, 69, 97, 84, 81, 133, 104, 136, 34, 36, 2,
+    9, 38, 6, 160, 137, 32, 105, 102, 100, 25, 153, 105, 165, 89, 41, 104,
+    101, 90, 10, 168, 24, 36, 42, 160, 66, 130, 66, 130, 130, 129, 97, 65,
+    97, 65, 65, 73, 82, 73, 89, 85, 98, 69, 130, 129, 129, 130, 66, 130,
+    161, 66, 170, 138, 170, 42, 82, 129, 81, 69, 65, 101, 137, 36, 128, 34,
+    25, 34, 137, 106, 138, 34, 41, 98, 169, 101, 165, 88, 89, 104, 64, 2,
+    66, 133, 128, 5, 98, 65, 105, 73, 96, 137, 98, 129, 97, 73, 70, 153,
+    9, 42, 2, 144, 153, 32, 105, 100, 102, 153, 25, 105, 73, 169, 69, 97,
+    86, 145, 137, 88, 136, 34, 32, 18, 26, 168, 8, 32, 42, 164, 37, 89,
+    169, 106, 101, 88, 5, 106, 10, 160, 160, 16, 98, 1, 97, 73, 73, 169,
+    137, 106, 10, 162, 169, 96, 128, 1, 145, 66, 64, 6, 101, 90, 104, 169,
+    37, 89, 98, 129, 101, 73, 82, 137, 169, 101, 165, 88, 89, 104, 64, 2,
+    66, 133, 128, 5, 137, 36, 128, 34, 25, 34, 137, 106, 138, 34, 41, 98,
+    98, 129, 97, 73, 70, 153, 98, 65, 105, 73, 96, 137, 82, 65, 89, 69,
+    66, 69, 130, 129, 129, 66, 130, 130, 66, 130, 66, 129, 130, 130, 97, 65,
+    97, 73, 65, 65, 82, 129, 81, 69, 73, 69, 162, 66, 170, 138, 169, 106,
+  },
+  {
+    128, 10, 170, 170, 168, 34, 105, 161, 81, 69, 70, 153, 64, 137, 73, 97,
+    105, 161, 41, 82, 34, 136, 132, 8, 169, 80, 160, 10, 0, 26, 70, 165,
+    69, 81, 89, 97, 65, 65, 73, 97, 97, 65, 42, 164, 32, 24, 10, 168,
+    89, 104, 88, 165, 169, 101, 130, 130, 129, 66, 66, 130, 128, 5, 133, 66,
+    64, 2, 101, 88, 106, 41, 165, 89, 70, 153, 73, 97, 98, 129, 169, 96,
+    162, 138, 9, 106, 64, 6, 66, 129, 144, 1, 25, 105, 153, 100, 105, 102,
+    64, 137, 105, 105, 97, 129, 169, 32, 128, 6, 8, 102, 41, 98, 34, 138,
+    137, 106, 82, 137, 73, 97, 98, 133, 41, 34, 18, 128, 136, 100, 82, 69,
+    101, 89, 81, 137, 37, 89, 169, 106, 101, 88, 130, 130, 66, 129, 130, 129,
+    42, 164, 32, 24, 10, 168, 65, 73, 73, 65, 97, 65, 128, 1, 129, 82,
+    80, 2, 101, 88, 106, 41, 165, 89, 89, 106, 90, 37, 41, 101, 130, 129,
+    129, 130, 66, 130, 105, 161, 81, 69, 70, 153, 130, 74, 170, 170, 169, 98,
+    165, 96, 160, 10, 4, 10, 66, 133, 69, 81, 81, 97, 66, 9, 73, 97,
+    106, 97, 41, 82, 34, 136, 132, 8, 66, 137, 89, 101, 98, 129, 169, 98,
+    162, 136, 137, 104, 165, 89, 41, 104, 101, 90, 66, 130, 66, 130, 130, 129,
+    25, 34, 2, 132, 136, 104, 66, 69, 101, 81, 81, 129, 169, 98, 160, 10,
+    137, 106, 66, 137, 73, 97, 102, 145, 66, 73, 105, 105, 98, 1, 169, 32,
+    128, 6, 8, 102, 64, 2, 70, 145, 128, 1, 25, 105, 153, 100, 105, 102,
+    153, 105, 25, 102, 105, 100, 64, 2, 70, 145, 128, 1, 153, 32, 144, 2,
+    8, 106, 64, 137, 105, 105, 97, 129, 70, 153, 73, 97, 98, 129, 169, 98,
+    160, 10, 137, 106, 66, 69, 69, 89, 81, 129, 41, 34, 18, 128, 136, 100,
+    66, 130, 130, 129, 130, 129, 165, 89, 41, 104, 101, 90, 41, 98, 34, 138,
+    137, 106, 66, 137, 89, 101, 98, 129, 37, 98, 34, 136, 128, 24, 66, 9,
+    73, 97, 106, 97, 74, 149, 69, 81, 89, 97, 165, 96, 160, 10, 4, 10,
+    129, 138, 170, 170, 168, 98, 106, 33, 81, 69, 69, 25, 130, 129, 130, 66,
+    66, 130, 89, 104, 88, 165, 169, 101, 101, 90, 104, 169, 37, 89, 128, 5,
+    133, 66, 64, 2, 65, 73, 65, 97, 97, 65, 42, 160, 36, 8, 26, 168,
+    66, 130, 66, 129, 130, 130, 37, 89, 169, 106, 101, 88, 98, 69, 101, 89,
+    81, 133, 25, 34, 2, 132, 136, 104, 82, 137, 73, 97, 98, 133, 169, 98,
+    162, 136, 137, 104, 153, 32, 144, 2, 8, 106, 66, 73, 105, 105, 98, 1,
+    153, 105, 25, 102, 105, 100, 64, 6, 66, 129, 144, 1, 169, 96, 162, 138,
+    9, 106, 66, 137, 73, 97, 102, 145, 101, 90, 104, 169, 37, 89, 128, 1,
+    129, 82, 80, 2, 130, 129, 129, 66, 130, 130, 89, 106, 90, 37, 41, 101,
+    42, 160, 36, 8, 26, 168, 65, 73, 73, 97, 65, 65, 66, 133, 69, 81,
+    89, 65, 169, 80, 160, 10, 0, 26, 37, 98, 34, 136, 128, 24, 64, 137,
+    73, 97, 105, 161, 106, 33, 81, 69, 69, 25, 129, 74, 170, 170, 168, 162,
+  },
+};
+// 4단계: 엣지
+const uint8_t tw_edge_distance[1728] PROGMEM = {
+  20, 85, 20, 146, 105, 69, 36, 149, 85, 65, 20, 128, 65, 1, 132, 137,
+  42, 170, 146, 105, 69, 40, 170, 170, 81, 64, 128, 150, 85, 86, 150, 85,
+  85, 65, 20, 128, 69, 0, 144, 150, 85, 85, 74, 42, 170, 81, 64, 128,
+  148, 85, 21, 154, 85, 101, 150, 85, 149, 65, 1, 132, 69, 0, 144, 36,
+  149, 85, 154, 85, 101, 64, 0, 128, 24, 85, 166, 169, 170, 169, 168, 149,
+  101, 82, 64, 0, 82, 64, 0, 130, 0, 65, 86, 85, 86, 24, 85, 101,
+  64, 0, 1, 130, 0, 65, 10, 2, 105, 1, 0, 1, 64, 0, 64, 34,
+  168, 65, 130, 0, 65, 145, 64, 0, 20, 85, 85, 42, 170, 106, 130, 0,
+  65, 1, 0, 64, 145, 64, 0, 148, 106, 89, 42, 170, 106, 20, 85, 85,
+  97, 149, 69, 104, 102, 149, 86, 4, 69, 25, 38, 16, 25, 24, 24, 85,
+  64, 81, 84, 153, 169, 89, 85, 101, 84, 36, 40, 65, 0, 65, 161, 32,
+  106, 5, 88, 40, 84, 26, 32, 137, 138, 66, 65, 21, 69, 72, 90, 16,
+  85, 106, 89, 165, 90, 102, 65, 0, 65, 5, 102, 32, 72, 100, 24, 66,
+  81, 81, 153, 165, 90, 85, 106, 89, 129, 64, 68, 24, 64, 16, 86, 0,
+  74, 0, 170, 41, 8, 170, 32, 98, 66, 130, 4, 16, 0, 1, 0, 66,
+  40, 42, 24, 162, 66, 129, 2, 134, 6, 41, 2, 32, 33, 42, 0, 160,
+  5, 136, 145, 128, 138, 40, 40, 40, 2, 0, 0, 0, 4, 16, 146, 128,
+  74, 40, 166, 32, 40, 136, 41, 133, 66, 129, 0, 21, 4, 16, 1, 128,
+  129, 4, 80, 24, 64, 16, 86, 2, 129, 32, 162, 40, 0, 170, 41, 98,
+  64, 138, 4, 4, 0, 1, 0, 66, 9, 34, 8, 146, 130, 129, 160, 18,
+  6, 40, 162, 36, 40, 106, 8, 2, 145, 136, 145, 130, 130, 40, 136, 41,
+  2, 0, 0, 0, 21, 4, 162, 64, 74, 41, 160, 0, 40, 138, 8, 133,
+  64, 74, 0, 16, 16, 4, 16, 128, 134, 42, 170, 66, 0, 129, 85, 17,
+  65, 40, 104, 24, 40, 106, 16, 40, 81, 16, 66, 0, 129, 89, 85, 85,
+  24, 168, 24, 66, 68, 65, 65, 0, 65, 40, 104, 24, 24, 170, 16, 65,
+  0, 65, 20, 38, 4, 24, 168, 24, 170, 128, 146, 65, 0, 65, 66, 0,
+  85, 40, 106, 16, 24, 170, 16, 85, 17, 65, 65, 0, 65, 85, 105, 101,
+  24, 85, 166, 86, 85, 86, 148, 106, 89, 1, 0, 1, 1, 0, 64, 130,
+  0, 65, 169, 170, 169, 24, 85, 101, 145, 64, 0, 130, 0, 65, 34, 168,
+  65, 82, 64, 0, 145, 64, 0, 10, 2, 105, 130, 0, 65, 64, 0, 1,
+  20, 85, 85, 42, 170, 106, 130, 0, 65, 82, 64, 0, 64, 0, 64, 168,
+  149, 101, 42, 170, 106, 20, 85, 85, 168, 170, 42, 146, 85, 69, 150, 85,
+  85, 65, 0, 2, 65, 0, 2, 86, 85, 85, 146, 85, 69, 66, 0, 66,
+  65, 0, 2, 36, 150, 153, 36, 150, 89, 65, 0, 2, 65, 0, 2, 36,
+  150, 89, 149, 85, 85, 65, 0, 2, 64, 0, 128, 150, 85, 85, 36, 150,
+  90, 65, 0, 2, 65, 0, 2, 150, 85, 85, 150, 85, 85, 65, 0, 0,
+  133, 16, 64, 0, 16, 16, 145, 2, 82, 40, 137, 40, 33, 136, 32, 82,
+  130, 130, 20, 64, 32, 1, 0, 66, 40, 162, 33, 162, 64, 137, 34, 6,
+  132, 40, 138, 8, 32, 162, 40, 128, 133, 10, 161, 64, 138, 1, 10, 40,
+  2, 0, 0, 4, 4, 0, 146, 130, 66, 40, 42, 9, 16, 170, 40, 66,
+  64, 153, 0, 21, 4, 0, 4, 144, 89, 101, 101, 66, 0, 129, 65, 0,
+  65, 40, 88, 40, 24, 152, 40, 66, 16, 69, 66, 0, 129, 97, 154, 73,
+  40, 90, 32, 85, 5, 86, 81, 5, 81, 40, 88, 40, 24, 154, 32, 81,
+  5, 81, 70, 64, 65, 40, 90, 32, 85, 89, 85, 65, 0, 65, 81, 85,
+  82, 24, 152, 40, 24, 154, 32, 65, 0, 65, 65, 0, 65, 105, 170, 105,
+  89, 85, 101, 98, 10, 33, 73, 138, 130, 8, 161, 72, 32, 33, 41, 65,
+  0, 65, 74, 160, 9, 97, 150, 73, 40, 9, 72, 69, 1, 85, 149, 166,
+  165, 32, 10, 100, 0, 137, 41, 169, 89, 153, 65, 0, 65, 0, 162, 100,
+  85, 106, 89, 169, 34, 66, 81, 84, 65, 8, 138, 5, 40, 34, 5, 97,
+  32, 170, 129, 136, 106, 101, 169, 85, 129, 64, 68, 4, 16, 0, 133, 66,
+  129, 41, 2, 32, 40, 166, 32, 98, 66, 130, 24, 64, 16, 1, 0, 66,
+  40, 40, 40, 162, 66, 129, 160, 5, 136, 0, 170, 41, 40, 136, 41, 2,
+  134, 6, 145, 128, 138, 40, 42, 24, 2, 0, 0, 0, 21, 4, 146, 128,
+  74, 8, 170, 32, 33, 42, 0, 86, 0, 74, 0, 4, 16, 16, 1, 128,
+  145, 1, 64, 0, 4, 16, 145, 0, 153, 9, 128, 40, 40, 152, 40, 82,
+  128, 138, 20, 64, 32, 1, 0, 66, 8, 170, 32, 146, 128, 137, 128, 146,
+  132, 40, 42, 9, 40, 162, 33, 34, 17, 10, 161, 66, 130, 4, 170, 40,
+  2, 0, 0, 0, 21, 4, 162, 66, 66, 40, 40, 40, 1, 168, 8, 66,
+  66, 82, 4, 16, 0, 0, 64, 132, 89, 85, 101, 74, 160, 9, 97, 32,
+  170, 32, 10, 100, 8, 138, 5, 65, 0, 65, 98, 10, 33, 97, 150, 73,
+  0, 162, 100, 69, 1, 85, 169, 89, 153, 8, 161, 72, 40, 34, 5, 149,
+  166, 165, 65, 0, 65, 40, 9, 72, 85, 106, 89, 129, 136, 106, 81, 84,
+  65, 32, 33, 41, 0, 137, 41, 73, 138, 130, 169, 34, 66, 101, 169, 85,
+  138, 42, 154, 66, 0, 129, 65, 68, 85, 20, 170, 32, 20, 168, 40, 20,
+  132, 36, 66, 0, 129, 85, 85, 101, 36, 106, 32, 82, 16, 65, 65, 0,
+  65, 20, 170, 32, 36, 104, 40, 65, 0, 65, 0, 89, 24, 36, 106, 32,
+  166, 128, 162, 65, 0, 65, 70, 1, 65, 20, 168, 40, 36, 104, 40, 65,
+  68, 85, 65, 0, 65, 89, 105, 85, 133, 16, 64, 20, 64, 32, 66, 64,
+  153, 40, 138, 8, 40, 42, 9, 82, 130, 130, 0, 16, 16, 1, 0, 66,
+  1, 10, 40, 162, 64, 137, 128, 133, 10, 40, 137, 40, 16, 170, 40, 34,
+  6, 132, 161, 64, 138, 40, 162, 33, 2, 0, 0, 0, 21, 4, 146, 130,
+  66, 33, 136, 32, 32, 162, 40, 145, 2, 82, 4, 4, 0, 0, 4, 144,
+  20, 85, 149, 81, 85, 69, 85, 86, 154, 2, 0, 0, 2, 0, 0, 106,
+  168, 32, 81, 85, 69, 128, 0, 64, 2, 0, 0, 85, 85, 149, 85, 86,
+  154, 2, 0, 0, 2, 0, 0, 85, 86, 154, 169, 168, 32, 2, 0, 0,
+  86, 85, 85, 85, 85, 85, 85, 85, 86, 2, 0, 0, 2, 0, 0, 85,
+  86, 154, 85, 85, 85, 42, 170, 168, 154, 85, 101, 106, 170, 42, 89, 86,
+  170, 64, 0, 64, 0, 1, 69, 65, 0, 65, 106, 170, 42, 89, 85, 101,
+  1, 0, 64, 65, 0, 65, 105, 128, 162, 0, 1, 69, 0, 1, 69, 65,
+  42, 138, 65, 0, 65, 0, 1, 69, 85, 85, 85, 169, 170, 170, 65, 0,
+  65, 64, 0, 1, 1, 0, 1, 101, 169, 150, 86, 85, 86, 85, 85, 150,
+  89, 89, 101, 66, 0, 129, 65, 0, 65, 24, 166, 32, 40, 102, 32, 66,
+  5, 65, 66, 0, 129, 97, 166, 73, 24, 164, 40, 69, 81, 86, 69, 80,
+  69, 24, 166, 32, 40, 100, 40, 69, 80, 69, 82, 0, 81, 24, 164, 40,
+  85, 101, 85, 65, 0, 65, 85, 84, 70, 40, 102, 32, 40, 100, 40, 65,
+  0, 65, 65, 0, 65, 105, 170, 105, 129, 4, 80, 4, 4, 0, 133, 64,
+  74, 40, 162, 36, 41, 160, 0, 98, 64, 138, 24, 64, 16, 1, 0, 66,
+  40, 136, 41, 146, 130, 129, 2, 145, 136, 32, 162, 40, 40, 138, 8, 160,
+  18, 6, 145, 130, 130, 9, 34, 8, 2, 0, 0, 0, 16, 16, 162, 64,
+  74, 0, 170, 41, 40, 106, 8, 86, 2, 129, 0, 21, 4, 4, 16, 128,
+  145, 1, 64, 20, 64, 32, 66, 66, 82, 40, 42, 9, 40, 40, 40, 82,
+  128, 138, 0, 4, 16, 1, 0, 66, 4, 170, 40, 146, 128, 137, 34, 17,
+  10, 9, 128, 40, 1, 168, 8, 128, 146, 132, 161, 66, 130, 8, 170, 32,
+  2, 0, 0, 4, 16, 0, 162, 66, 66, 40, 152, 40, 40, 162, 33, 145,
+  0, 153, 0, 21, 4, 0, 64, 132, 97, 149, 69, 84, 153, 169, 66, 81,
+  81, 5, 88, 40, 5, 102, 32, 85, 64, 81, 104, 102, 149, 89, 85, 101,
+  72, 90, 16, 65, 0, 65, 137, 138, 66, 25, 38, 16, 72, 100, 24, 161,
+  32, 106, 65, 21, 69, 84, 36, 40, 85, 106, 89, 153, 165, 90, 65, 0,
+  65, 25, 24, 24, 84, 26, 32, 86, 4, 69, 165, 90, 102, 85, 106, 89,
+  154, 85, 101, 106, 170, 42, 101, 169, 150, 0, 1, 69, 64, 0, 1, 65,
+  0, 65, 106, 170, 42, 89, 85, 101, 0, 1, 69, 65, 0, 65, 65, 42,
+  138, 64, 0, 64, 1, 0, 1, 105, 128, 162, 65, 0, 65, 1, 0, 64,
+  85, 85, 85, 86, 85, 86, 65, 0, 65, 0, 1, 69, 0, 1, 69, 89,
+  86, 170, 169, 170, 170, 85, 85, 150, 128, 0, 64, 81, 85, 69, 85, 86,
+  154, 132, 0, 16, 144, 64, 0, 149, 85, 150, 81, 85, 69, 1, 0, 64,
+  128, 1, 4, 166, 150, 154, 101, 149, 150, 132, 0, 16, 128, 20, 0, 101,
+  149, 150, 86, 85, 150, 128, 1, 4, 170, 170, 40, 85, 105, 85, 166, 150,
+  154, 144, 64, 0, 128, 20, 0, 85, 86, 154, 85, 105, 85, 0, 0, 0,
+};
+
+#endif  // !THISTLETHWAITE_TABLES_H
@@ -0,0 +1,240 @@
+#ifndef TWO_PHASE_H
+#define TWO_PHASE_H
+
+#include "CoordCube.h"
+
+/* 2-phase(Kociemba) 해법
+ *
+ * solve()의 층별 해법은 쿼터 턴 100개 이상을 내놓는 경우가 많은데, 그 하나하나가 motor_write() 한 번입니다.
+ * 이 해법은 CoordCube의 좌표 위에서 두 단계의 IDA* 탐색으로 보통 20~25회 회전 안쪽의 해법을 찾습니다.
+ *
+ * 1단계: 임의의 상태 -> G1 = <W, Y, G2, B2, O2, R2>
+ *        (코너 방향 0, 엣지 방향 0, 가운데 층 엣지 4~7이 가운데 층에 있음)
+ * 2단계: G1 -> 맞춰진 상태, G1 안의 회전만 사용
+ * 가지치기 표는 (twist, slice), (flip, slice), (corner_perm, slice_perm), (ud_edge_perm, slice_perm)의
+ * 최소 회전 수를 BFS로 미리 구해 둔 것입니다.
+ *
+ * two_phase_solve()는 해법을 solve()와 같은 알파벳으로 container에 저장합니다.
+ * 180도 회전은 축 번호 숫자 하나(half_turn_char)로 기록됩니다.
+ * 회전 수(180도를 1회로 셈) 상한과 시간 예산(ms)을 받아, 예산 안에 상한 이하의 해법을 찾지 못하면
+ * 기존 solve()로 대신 해법을 구합니다. 어느 쪽이든 전역 상태는 맞춰진 상태가 됩니다.
+ *
+ * CoordCube와 마찬가지로 표가 커서 호스트 전용입니다.
+ */
+#ifndef TWO_PHASE_MAX_LENGTH
+#define TWO_PHASE_MAX_LENGTH 24
+#endif
+#ifndef TWO_PHASE_TIME_BUDGET_MS
+#define TWO_PHASE_TIME_BUDGET_MS 1000
+#endif
+
+constexpr uint8_t TWO_PHASE_DEPTH_LIMIT = 31;
+constexpr uint8_t PRUNING_UNKNOWN = 0xFF;
+
+uint8_t twist_slice_pruning[TWIST_COUNT * SLICE_COUNT];
+uint8_t flip_slice_pruning[FLIP_COUNT * SLICE_COUNT];
+uint8_t corner_slice_pruning[CORNER_PERM_COUNT * 24];
+uint8_t ud_edge_slice_pruning[UD_EDGE_PERM_COUNT * 24];
+bool two_phase_tables_ready = false;
+
+/* 1. 가지치기 표
+ *
+ * 두 좌표를 묶은 번호(a * b_count + b)마다 맞춰진 상태(0, 0)까지의 최소 회전 수를 저장합니다.
+ * 1단계 표는 18가지 회전, 2단계 표는 G1 안의 회전 10가지로 BFS합니다.
+ */
+inline void build_pruning(uint8_t* table, uint32_t a_count, uint32_t b_count,
+                          const uint16_t* a_move, const uint16_t* b_move, bool g1_only) {
+  memset(table, PRUNING_UNKNOWN, a_count * b_count);
+  table[0] = 0;
+  uint32_t filled = 1;
+  for (uint8_t depth = 0; filled < a_count * b_count; ++depth) {
+    for (uint32_t index = 0; index < a_count * b_count; ++index) {
+      if (table[index] != depth) {
+        continue;
+      }
+      uint32_t a = index / b_count;
+      uint32_t b = index % b_count;
+      for (uint8_t move = 0; move < MOVE_COUNT; ++move) {
+        if (g1_only && !is_g1_move(move)) {
+          continue;
+        }
+        uint32_t next = a_move[a * MOVE_COUNT + move] * b_count + b_move[b * MOVE_COUNT + move];
+        if (table[next] == PRUNING_UNKNOWN) {
+          table[next] = depth + 1;
+          filled++;
+        }
+      }
+    }
+  }
+}
+
+inline void two_phase_init() {
+  if (two_phase_tables_ready) {
+    return;
+  }
+  coord_init();
+
+  // 1단계의 slice 좌표는 가운데 층 엣지가 차지한 자리의 조합(edge4 / 24)입니다.
+  static uint16_t slice_move_table[SLICE_COUNT][MOVE_COUNT];
+  for (uint16_t slice = 0; slice < SLICE_COUNT; ++slice) {
+    for (uint8_t move = 0; move < MOVE_COUNT; ++move) {
+      slice_move_table[slice][move] = edge4_move_table[EDGE_GROUP_SLICE][slice * 24][move] / 24;
+    }
+  }
+  build_pruning(twist_slice_pruning, TWIST_COUNT, SLICE_COUNT, &twist_move_table[0][0], &slice_move_table[0][0], false);
+  build_pruning(flip_slice_pruning, FLIP_COUNT, SLICE_COUNT, &flip_move_table[0][0], &slice_move_table[0][0], false);
+  // G1 안에서 가운데 층 엣지의 edge4 좌표는 0..23이고, 그 값이 곧 가운데 층 안의 순서입니다.
+  build_pruning(corner_slice_pruning, CORNER_PERM_COUNT, 24, &corner_perm_move_table[0][0], &edge4_move_table[EDGE_GROUP_SLICE][0][0], true);
+  build_pruning(ud_edge_slice_pruning, UD_EDGE_PERM_COUNT, 24, &ud_edge_perm_move_table[0][0], &edge4_move_table[EDGE_GROUP_SLICE][0][0], true);
+
+  two_phase_tables_ready = true;
+}
+
+/* 2. 탐색
+ *
+ * 같은 축을 연달아 돌리는 경우 등은 skip_move()로 건너뜁니다.
+ */
+struct TwoPhaseSearch {
+  uint8_t c_pos[8], c_ori[8], e_pos[12], e_ori[12];  // 탐색을 시작한 상태
+  uint8_t moves[TWO_PHASE_DEPTH_LIMIT];
+  uint8_t max_length;
+  uint8_t length;  // 찾은 해법의 길이
+  uint32_t deadline;
+  bool timed_out;
+  uint32_t node_count;
+};
+
+
+// 노드 1024개마다 시간 예산을 확인합니다.
+inline bool search_expired(TwoPhaseSearch& search) {
+  if ((++search.node_count & 0x3FF) == 0 && millis() >= search.deadline) {
+    search.timed_out = true;
+  }
+  return search.timed_out;
+}
+
+inline bool phase2_search(TwoPhaseSearch& search, uint16_t corner_perm, uint16_t ud_edge_perm, uint16_t slice_perm,
+                          uint8_t depth, uint8_t remaining) {
+  if (search_expired(search)) {
+    return false;
+  }
+  if (remaining == 0) {
+    return corner_perm == 0 && ud_edge_perm == 0 && slice_perm == 0;
+  }
+  for (uint8_t move = 0; move < MOVE_COUNT; ++move) {
+    if (!is_g1_move(move) || skip_move(search.moves, depth, move)) {
+      continue;
+    }
+    uint16_t next_corner = corner_perm_move_table[corner_perm][move];
+    uint16_t next_ud_edge = ud_edge_perm_move_table[ud_edge_perm][move];
+    uint16_t next_slice = edge4_move_table[EDGE_GROUP_SLICE][slice_perm][move];
+    uint8_t distance = corner_slice_pruning[next_corner * 24 + next_slice];
+    uint8_t ud_distance = ud_edge_slice_pruning[next_ud_edge * 24 + next_slice];
+    if ((distance > ud_distance ? distance : ud_distance) >= remaining) {
+      continue;
+    }
+    search.moves[depth] = move;
+    if (phase2_search(search, next_corner, next_ud_edge, next_slice, depth + 1, remaining - 1)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// 1단계 해법으로 G1에 도달하면 시작 상태에 그 해법을 적용해서 2단계 좌표를 구하고 2단계를 탐색합니다.
+inline bool phase2_start(TwoPhaseSearch& search, uint8_t phase1_length) {
+  uint8_t c_pos[8], c_ori[8], e_pos[12], e_ori[12];
+  memcpy(c_pos, search.c_pos, 8);
+  memcpy(c_ori, search.c_ori, 8);
+  memcpy(e_pos, search.e_pos, 12);
+  memcpy(e_ori, search.e_ori, 12);
+  for (uint8_t i = 0; i < phase1_length; ++i) {
+    turn_cubies_move(c_pos, c_ori, e_pos, e_ori, search.moves[i]);
+  }
+  uint16_t corner_perm = get_corner_perm(c_pos);
+  uint16_t ud_edge_perm = get_ud_edge_perm(e_pos);
+  uint16_t slice_perm = get_edge4(e_pos, EDGE_GROUP_SLICE);
+
+  uint8_t distance = corner_slice_pruning[corner_perm * 24 + slice_perm];
+  uint8_t ud_distance = ud_edge_slice_pruning[ud_edge_perm * 24 + slice_perm];
+  uint8_t lower_bound = distance > ud_distance ? distance : ud_distance;
+  for (uint8_t phase2_length = lower_bound; phase1_length + phase2_length <= search.max_length; ++phase2_length) {
+    if (phase2_search(search, corner_perm, ud_edge_perm, slice_perm, phase1_length, phase2_length)) {
+      search.length = phase1_length + phase2_length;
+      return true;
+    }
+  }
+  return false;
+}
+
+inline bool phase1_search(TwoPhaseSearch& search, uint16_t twist, uint16_t flip, uint16_t slice,
+                          uint8_t depth, uint8_t remaining) {
+  if (search_expired(search)) {
+    return false;
+  }
+  if (remaining == 0) {
+    // 1단계의 마지막 회전이 G1 안의 회전이면, 더 짧은 1단계 해법에서 이미 탐색한 경우입니다.
+    if (twist != 0 || flip != 0 || slice != 0) {
+      return false;
+    }
+    if (depth > 0 && is_g1_move(search.moves[depth - 1])) {
+      return false;
+    }
+    return phase2_start(search, depth);
+  }
+  for (uint8_t move = 0; move < MOVE_COUNT; ++move) {
+    if (skip_move(search.moves, depth, move)) {
+      continue;
+    }
+    uint16_t next_twist = twist_move_table[twist][move];
+    uint16_t next_flip = flip_move_table[flip][move];
+    uint16_t next_slice = edge4_move_table[EDGE_GROUP_SLICE][slice * 24][move] / 24;
+    uint8_t distance = twist_slice_pruning[next_twist * SLICE_COUNT + next_slice];
+    uint8_t flip_distance = flip_slice_pruning[next_flip * SLICE_COUNT + next_slice];
+    if ((distance > flip_distance ? distance : flip_distance) >= remaining) {
+      continue;
+    }
+    search.moves[depth] = move;
+    if (phase1_search(search, next_twist, next_flip, next_slice, depth + 1, remaining - 1)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/* 3. 해법 구하기
+ *
+ * 전역 상태의 해법을 container에 저장합니다. 2-phase 해법을 찾으면 true,
+ * 예산을 다 써서 solve()로 대신했으면 false를 반환합니다.
+ */
+inline bool two_phase_solve(uint8_t max_length = TWO_PHASE_MAX_LENGTH, uint32_t time_budget_ms = TWO_PHASE_TIME_BUDGET_MS) {
+  two_phase_init();
+
+  TwoPhaseSearch search;
+  cube.unpack(search.c_pos, search.c_ori, search.e_pos, search.e_ori);
+  search.max_length = max_length < TWO_PHASE_DEPTH_LIMIT ? max_length : TWO_PHASE_DEPTH_LIMIT;
+  search.deadline = millis() + time_budget_ms;
+  search.timed_out = false;
+  search.node_count = 0;
+
+  CoordCube coord = coord_from_cube();
+  uint16_t slice = coord.edge4[EDGE_GROUP_SLICE] / 24;
+  bool found = false;
+  for (uint8_t phase1_length = 0; phase1_length <= search.max_length && !found && !search.timed_out; ++phase1_length) {
+    found = phase1_search(search, coord.twist, coord.flip, slice, 0, phase1_length);
+  }
+
+  if (!found) {
+    solve();
+    return false;
+  }
+
+  container.clear();
+  for (uint8_t i = 0; i < search.length; ++i) {
+    append_move(container, search.moves[i]);
+    turn_cube_move(cube, search.moves[i]);
+  }
+  return true;
+}
+
+#endif  // !TWO_PHASE_H
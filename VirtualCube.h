@@ -1,6 +1,8 @@
 #ifndef VIRTUAL_CUBE_H
 #define VIRTUAL_CUBE_H
 
+#include "MoveBuffer.h"
+
 /* 1. 함수 인자로 사용하기 위한 enum
  *    큐브의 방향 등의 의미도 내포하고 있습니다.
  *
@@ -27,7 +29,39 @@ char color_char[6] = {
   'O',
   'R',
 };
-String container;
+// 180도 회전을 나타내는 글자입니다. 축 번호를 숫자로 씁니다.
+char half_turn_char[6] = {
+  '0',
+  '1',
+  '2',
+  '3',
+  '4',
+  '5',
+};
+// 해법을 구하는 동안 바뀌는 전역 변수(container, cube, 기록, 탐색 상태) 앞에 붙는 저장 방식입니다.
+// 기본값은 비어 있어서 보통의 전역 변수이며, 여러 스레드에서 동시에 푸는 호스트 도구는 thread_local로 정의해서 스레드마다 따로 둡니다.
+#ifndef CUBE_THREAD_LOCAL
+#define CUBE_THREAD_LOCAL
+#endif
+
+CUBE_THREAD_LOCAL MoveBuffer container;  // 회전 기록과 solve()의 해법이 저장되는 고정 크기 버퍼입니다.
+
+// solve()의 각 단계가 시작될 때 단계 번호(1~SOLVE_FINAL_STAGE, 종료 시 SOLVE_FINAL_STAGE + 1)와 함께 호출되는 훅입니다.
+// 기본값은 아무 일도 하지 않으며, 호스트 벤치마크 등에서 측정을 위해 미리 정의해서 사용합니다.
+#ifndef SOLVE_STAGE_HOOK
+#define SOLVE_STAGE_HOOK(stage)
+#endif
+// solve()에서 반복 횟수가 상태에 따라 정해지는 반복문이 한 번 돌 때마다 위치 번호(SOLVE_LOOP_*)와 함께 호출되는 훅입니다.
+// host/explore_solve.cpp가 반복 횟수의 최댓값을 찾고, 만들 수 없는 상태에서 끝나지 않는 반복문을 잡는 데 씁니다.
+#ifndef SOLVE_LOOP_HOOK
+#define SOLVE_LOOP_HOOK(site)
+#endif
+constexpr uint8_t SOLVE_LOOP_WHITE_CROSS = 0;     // 1단계: 흰 엣지를 찾는 전체 반복
+constexpr uint8_t SOLVE_LOOP_PAIR_SLOTS = 1;      // 2단계: 맞출 칸을 고르는 반복
+constexpr uint8_t SOLVE_LOOP_PAIR_MACROS = 2;     // 2단계: 두 층 표를 따라 수행한 회전열
+constexpr uint8_t SOLVE_LOOP_ORIENTATION = 3;     // 3단계: 방향 표를 따라 수행한 알고리즘
+constexpr uint8_t SOLVE_LOOP_PERMUTATION = 4;     // 4단계: 위치 표를 따라 수행한 알고리즘
+constexpr uint8_t SOLVE_LOOP_COUNT = 5;
 
 /* 2. 큐브의 저장 방식
  * 
@@ -37,129 +71,424 @@ String container;
  *   엣지 센터 엣지
  *   코너 엣지 코너
  */
-uint8_t corner_pos[8];
-uint8_t corner_ori[8];
-uint8_t edge_pos[12];
-uint8_t edge_ori[12];
+// 축을 인덱스로 회전의 대상이 될 코너 큐브의 인덱스 목록입니다.
+constexpr uint8_t corner_rotation_target[6][4] = {
+  { 1, 2, 3, 0 },  // U
+  { 7, 6, 5, 4 },  // D
+  { 3, 7, 4, 0 },  // F
+  { 5, 6, 2, 1 },  // B
+  { 6, 7, 3, 2 },  // L
+  { 4, 5, 1, 0 },  // R
+};
+// 축을 인덱스로 회전의 대상이 될 엣지 큐브의 인덱스 목록입니다.
+constexpr uint8_t edge_rotation_target[6][4] = {
+  { 1, 2, 3, 0 },    // U
+  { 11, 10, 9, 8 },  // D
+  { 7, 8, 4, 0 },    // F
+  { 5, 10, 6, 2 },   // B
+  { 6, 11, 7, 3 },   // L
+  { 4, 9, 5, 1 },    // R
+};
+// 축을 인덱스로 (회전의 대상이 될 코너 큐브)의 추가 회전수 목록입니다.
+constexpr uint8_t corner_ori_delta[6][4] = {
+  { 0, 0, 0, 0 },  // U
+  { 0, 0, 0, 0 },  // D
+  { 2, 1, 2, 1 },  // F
+  { 1, 2, 1, 2 },  // B
+  { 1, 2, 1, 2 },  // L
+  { 1, 2, 1, 2 },  // R
+};
+// 축을 인덱스로 (회전의 대상이 될 엣지 큐브)의 추가 회전 여부 목록입니다.
+constexpr uint8_t edge_ori_flip[6] = {
+  false,  // U
+  false,  // D
+  false,  // F
+  false,  // B
+  true,   // L
+  true,   // R
+};
+// 배열로 주어진 큐브 상태에 축의 시계방향 90도 회전을 한 번 적용하는 함수입니다.
+// 좌표 기반 탐색과 표 생성처럼 자리별 배열로 다루는 곳에서 사용합니다. 전역 상태(cube)는 CubeState::turn()으로 돌립니다.
+inline void turn_cubies(uint8_t c_pos[8], uint8_t c_ori[8], uint8_t e_pos[12], uint8_t e_ori[12], int axis) {
+  // 코너의 회전입니다.
+  uint8_t corner_pos_temp = c_pos[corner_rotation_target[axis][0]];
+  uint8_t corner_ori_temp = c_ori[corner_rotation_target[axis][0]];
+  for (int j = 0; j < 3; ++j) {
+    c_pos[corner_rotation_target[axis][j]] = c_pos[corner_rotation_target[axis][j + 1]];
+    c_ori[corner_rotation_target[axis][j]] = (c_ori[corner_rotation_target[axis][j + 1]] + corner_ori_delta[axis][j]) % 3;
+  }
+  c_pos[corner_rotation_target[axis][3]] = corner_pos_temp;
+  c_ori[corner_rotation_target[axis][3]] = (corner_ori_temp + corner_ori_delta[axis][3]) % 3;
+  // 엣지의 회전입니다.
+  uint8_t edge_pos_temp = e_pos[edge_rotation_target[axis][0]];
+  uint8_t edge_ori_temp = e_ori[edge_rotation_target[axis][0]];
+  for (int j = 0; j < 3; ++j) {
+    e_pos[edge_rotation_target[axis][j]] = e_pos[edge_rotation_target[axis][j + 1]];
+    e_ori[edge_rotation_target[axis][j]] = e_ori[edge_rotation_target[axis][j + 1]] ^ edge_ori_flip[axis];
+  }
+  e_pos[edge_rotation_target[axis][3]] = edge_pos_temp;
+  e_ori[edge_rotation_target[axis][3]] = edge_ori_temp ^ edge_ori_flip[axis];
+}
+/* 큐브 상태
+ *
+ * 자리마다 놓인 조각 번호와 방향을 한 바이트(칸)씩 담은 20바이트 값 타입입니다.
+ *   corners[i]: 자리 i의 코너입니다. 아래 3비트가 조각 번호, 그 위 2비트가 방향(0~2)입니다.
+ *   edges[i]:   자리 i의 엣지입니다. 아래 4비트가 조각 번호, 그 위 1비트가 방향(0~1)입니다.
+ * 복사와 비교는 20바이트로 끝나고, 회전은 돌아가는 네 자리의 칸을 옮기면서 코너는 방향을 더하고 엣지는 방향 비트를 뒤집습니다.
+ * 자리 번호가 곧 첨자라서 읽기와 회전에 시프트가 없습니다. 64비트 정수 두 개에 5비트씩 묶으면 16바이트로 줄지만
+ * 자리마다 거리가 다른 64비트 시프트가 필요해서, AVR에서는 시프트마다 라이브러리 호출이 되고 호스트에서도 회전이 두 배 가까이 느립니다.
+ * 좌표 변환처럼 위치와 방향을 나눈 배열이 필요한 곳은 unpack()/pack()으로 turn_cubies()의 배열 형식과 오갑니다.
+ */
+struct CubeState {
+  uint8_t corners[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+  uint8_t edges[12] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+  uint8_t corner_pos(uint8_t pos) const {
+    return corners[pos] & 7;
+  }
+  uint8_t corner_ori(uint8_t pos) const {
+    return corners[pos] >> 3;
+  }
+  uint8_t edge_pos(uint8_t pos) const {
+    return edges[pos] & 15;
+  }
+  uint8_t edge_ori(uint8_t pos) const {
+    return edges[pos] >> 4;
+  }
+  void set_corner(uint8_t pos, uint8_t piece, uint8_t ori) {
+    corners[pos] = piece | ori << 3;
+  }
+  void set_edge(uint8_t pos, uint8_t piece, uint8_t ori) {
+    edges[pos] = piece | ori << 4;
+  }
+
+  // 축의 시계방향 90도 회전을 한 번 적용합니다. turn_cubies()와 같은 규칙입니다.
+  void turn(uint8_t axis) {
+    const uint8_t* target = corner_rotation_target[axis];
+    const uint8_t* delta = corner_ori_delta[axis];
+    uint8_t first = corners[target[0]];
+    for (uint8_t j = 0; j < 3; ++j) {
+      corners[target[j]] = twisted(corners[target[j + 1]], delta[j]);
+    }
+    corners[target[3]] = twisted(first, delta[3]);
+
+    target = edge_rotation_target[axis];
+    uint8_t flip = edge_ori_flip[axis] << 4;
+    first = edges[target[0]];
+    for (uint8_t j = 0; j < 3; ++j) {
+      edges[target[j]] = edges[target[j + 1]] ^ flip;
+    }
+    edges[target[3]] = first ^ flip;
+  }
+  // 코너 칸에 방향 delta를 더합니다. 3 이상이 되면 칸 값이 24 이상이 되므로 24를 뺍니다.
+  static uint8_t twisted(uint8_t field, uint8_t delta) {
+    field += delta << 3;
+    return field >= 24 ? field - 24 : field;
+  }
+  bool operator==(const CubeState& other) const {
+    return memcmp(corners, other.corners, sizeof(corners)) == 0 && memcmp(edges, other.edges, sizeof(edges)) == 0;
+  }
+  bool operator!=(const CubeState& other) const {
+    return !(*this == other);
+  }
+  bool solved() const {
+    return *this == CubeState();
+  }
+  uint32_t hash() const {  // 20바이트의 FNV-1a입니다.
+    uint32_t hash = 2166136261u;
+    for (uint8_t field : corners) {
+      hash = (hash ^ field) * 16777619u;
+    }
+    for (uint8_t field : edges) {
+      hash = (hash ^ field) * 16777619u;
+    }
+    return hash;
+  }
+
+  void unpack(uint8_t c_pos[8], uint8_t c_ori[8], uint8_t e_pos[12], uint8_t e_ori[12]) const {
+    for (uint8_t pos = 0; pos < 8; ++pos) {
+      c_pos[pos] = corner_pos(pos);
+      c_ori[pos] = corner_ori(pos);
+    }
+    for (uint8_t pos = 0; pos < 12; ++pos) {
+      e_pos[pos] = edge_pos(pos);
+      e_ori[pos] = edge_ori(pos);
+    }
+  }
+  static CubeState pack(const uint8_t c_pos[8], const uint8_t c_ori[8], const uint8_t e_pos[12], const uint8_t e_ori[12]) {
+    CubeState state;
+    for (uint8_t pos = 0; pos < 8; ++pos) {
+      state.set_corner(pos, c_pos[pos], c_ori[pos]);
+    }
+    for (uint8_t pos = 0; pos < 12; ++pos) {
+      state.set_edge(pos, e_pos[pos], e_ori[pos]);
+    }
+    return state;
+  }
+};
+CUBE_THREAD_LOCAL CubeState cube;  // cube_update()가 rotate()로 갱신하고 solve()가 맞추는 큐브의 상태입니다.
 // 큐브의 상태를 초기화하는 함수입니다.
 inline void reset_cube() {
-  for (int i = 0; i < 8; ++i) {
-    corner_pos[i] = i;
-    corner_ori[i] = 0;
+  cube = CubeState();
+}
+/* 회전 번호
+ *
+ * 탐색 기반 해법들은 회전을 0..17의 번호(move) 하나로 다룹니다.
+ * move = axis * 3 + (count - 1)이며, count 1은 90도 시계방향(대문자), 2는 180도, 3은 90도 반시계방향(소문자)입니다.
+ */
+constexpr uint8_t MOVE_COUNT = 18;
+inline uint8_t move_axis(uint8_t move) {
+  return move / 3;
+}
+inline uint8_t move_count(uint8_t move) {
+  return move % 3 + 1;
+}
+// 배열 상태에 회전 번호 하나를 적용합니다.
+inline void turn_cubies_move(uint8_t c_pos[8], uint8_t c_ori[8], uint8_t e_pos[12], uint8_t e_ori[12], uint8_t move) {
+  for (uint8_t i = 0; i < move_count(move); ++i) {
+    turn_cubies(c_pos, c_ori, e_pos, e_ori, move_axis(move));
+  }
+}
+// 큐브 상태에 회전 번호 하나를 적용합니다.
+inline void turn_cube_move(CubeState& state, uint8_t move) {
+  for (uint8_t i = 0; i < move_count(move); ++i) {
+    state.turn(move_axis(move));
+  }
+}
+// 탐색 중 moves[depth - 1] 다음에 move를 두는 것이 의미 없는 경우인지 확인합니다.
+// 같은 축을 연달아 돌리거나, 마주 보는 축(W/Y, G/B, O/R)을 큰 번호 -> 작은 번호 순서로 돌리는 경우는
+// 다른 순서로 이미 탐색한 것과 같으므로 건너뜁니다.
+inline bool skip_move(const uint8_t* moves, uint8_t depth, uint8_t move) {
+  if (depth == 0) {
+    return false;
+  }
+  uint8_t last_axis = move_axis(moves[depth - 1]);
+  uint8_t axis = move_axis(move);
+  return axis == last_axis || (axis / 2 == last_axis / 2 && axis < last_axis);
+}
+// 회전 번호 하나의 해법 알파벳입니다.
+inline char move_char(uint8_t move) {
+  char c = color_char[move_axis(move)];
+  switch (move_count(move)) {
+    case 2: return half_turn_char[move_axis(move)];
+    case 3: return c - 'A' + 'a';
+    default: return c;
+  }
+}
+// 회전 번호 하나를 해법 알파벳으로 기록합니다.
+inline void append_move(MoveBuffer& buffer, uint8_t move) {
+  buffer.append(move_char(move));
+}
+/* 회전 정리
+ *
+ * 해법 알파벳을 같은 효과의 가장 짧은 회전열로 바꿉니다. 회전 하나가 모터 동작 하나입니다.
+ *   - 같은 축의 연속 회전은 90도 단위로 합쳐 4로 나눈 나머지만 남깁니다(Ww, WWWW는 사라지고 WWW는 w).
+ *   - 마주 보는 축(W/Y, G/B, O/R)은 서로 교환되므로 W Y W처럼 사이에 끼어 있어도 합칩니다.
+ *   - 마주 보는 두 축이 나란히 남으면 번호가 작은 축을 먼저 둡니다.
+ *   - 180도 회전은 half_turn_char 한 글자로 씁니다. 모터가 한 번에 512만큼 돌고 한 번만 멈춥니다.
+ *   - 공백(예전 정리 단계가 남기던 빈 자리)은 건너뜁니다.
+ * 정리된 회전들은 스택처럼 앞에서부터 쌓으면서 맨 위(또는 그 아래의 마주 보는 축)와 합치므로,
+ * 한 번 훑는 것으로 더 이상 줄어들지 않는 상태(고정점)에 도달합니다.
+ * 스택은 이미 읽은 자리에 (axis * 4 + count)로 덮어써서 추가 메모리 없이 제자리에서 정리합니다.
+ */
+inline bool parse_move_char(char c, uint8_t& axis, uint8_t& count) {
+  for (axis = 0; axis < 6; ++axis) {
+    if (c == color_char[axis]) {
+      count = 1;
+      return true;
+    }
+    if (c == color_char[axis] - 'A' + 'a') {
+      count = 3;
+      return true;
+    }
+    if (c == half_turn_char[axis]) {
+      count = 2;
+      return true;
+    }
+  }
+  return false;
+}
+inline void optimize_moves(MoveBuffer& buffer) {
+  uint16_t size = 0;
+  for (uint16_t i = 0; i < buffer.length(); ++i) {
+    uint8_t axis, count;
+    if (!parse_move_char(buffer[i], axis, count)) {
+      continue;
+    }
+    // 맨 위가 같은 축이거나, 맨 위가 마주 보는 축이고 그 아래가 같은 축이면 합칩니다.
+    uint16_t target = size;
+    if (size >= 1 && buffer[size - 1] / 4 == axis) {
+      target = size - 1;
+    } else if (size >= 2 && buffer[size - 1] / 4 / 2 == axis / 2 && buffer[size - 2] / 4 == axis) {
+      target = size - 2;
+    }
+    if (target < size) {
+      count = (count + buffer[target] % 4) % 4;
+      if (count != 0) {
+        buffer[target] = axis * 4 + count;
+      } else {
+        buffer[target] = buffer[size - 1];
+        size--;
+      }
+      continue;
+    }
+    buffer[size++] = axis * 4 + count;
+    if (size >= 2 && buffer[size - 2] / 4 / 2 == axis / 2 && buffer[size - 2] / 4 > axis) {
+      buffer[size - 1] = buffer[size - 2];
+      buffer[size - 2] = axis * 4 + count;
+    }
   }
-  for (int i = 0; i < 12; ++i) {
-    edge_pos[i] = i;
-    edge_ori[i] = 0;
+
+  // 회전마다 한 글자씩 알파벳으로 되돌립니다.
+  for (uint16_t i = 0; i < size; ++i) {
+    uint8_t axis = buffer[i] / 4;
+    switch (buffer[i] % 4) {
+      case 1: buffer[i] = color_char[axis]; break;
+      case 2: buffer[i] = half_turn_char[axis]; break;
+      case 3: buffer[i] = color_char[axis] - 'A' + 'a'; break;
+    }
   }
+  buffer.size = size;
+}
+// buffer[begin]부터 동시에 돌릴 수 있는 회전들의 끝(다음 단계의 시작 위치)을 반환합니다.
+// 마주 보는 두 면은 서로 교환되고 모터도 따로 있으므로, 정리된 해법에서 나란히 있는 W Y 같은 쌍을 한 단계로 묶습니다.
+inline uint16_t parallel_step_end(const MoveBuffer& buffer, uint16_t begin) {
+  uint8_t axis, count, next_axis;
+  if (begin + 1 >= buffer.length() || !parse_move_char(buffer[begin], axis, count)
+      || !parse_move_char(buffer[begin + 1], next_axis, count)) {
+    return begin + 1;
+  }
+  return next_axis != axis && next_axis / 2 == axis / 2 ? begin + 2 : begin + 1;
 }
 // 큐브의 축과 회전 방향을 인자로 큐브의 회전을 수행하는 함수입니다.
 // count가 양수면 시계방향, 음수면 반시계방향 회전합니다.
 inline void rotate(Color axis, uint8_t count) {
-  constexpr uint8_t corner_rotation_target[6][4] = {
-    // 축을 인덱스로 회전의 대상이 될 코너 큐브의 인덱스 목록을 사용합니다.
-    { 1, 2, 3, 0 },  // U
-    { 7, 6, 5, 4 },  // D
-    { 3, 7, 4, 0 },  // F
-    { 5, 6, 2, 1 },  // B
-    { 6, 7, 3, 2 },  // L
-    { 4, 5, 1, 0 },  // R
-  };
-  constexpr uint8_t edge_rotation_target[6][4] = {
-    // 축을 인덱스로 회전의 대상이 될 엣지 큐브의 인덱스 목록을 사용합니다.
-    { 1, 2, 3, 0 },    // U
-    { 11, 10, 9, 8 },  // D
-    { 7, 8, 4, 0 },    // F
-    { 5, 10, 6, 2 },   // B
-    { 6, 11, 7, 3 },   // L
-    { 4, 9, 5, 1 },    // R
-  };
-  constexpr uint8_t corner_ori_delta[6][4] = {
-    // 축을 인덱스로 (회전의 대상이 될 코너 큐브)의 추가 회전수 목록을 사용합니다.
-    { 0, 0, 0, 0 },  // U
-    { 0, 0, 0, 0 },  // D
-    { 2, 1, 2, 1 },  // F
-    { 1, 2, 1, 2 },  // B
-    { 1, 2, 1, 2 },  // L
-    { 1, 2, 1, 2 },  // R
-  };
-  constexpr uint8_t edge_ori_flip[6] = {
-    // 축을 인덱스로 (회전의 대상이 될 엣지 큐브)의 추가 회전 여부 목록을 사용합니다.
-    false,  // U
-    false,  // D
-    false,  // F
-    false,  // B
-    true,   // L
-    true,   // R
-  };
-
   count = (4 + count % 4) % 4;         // 회전 4번마다 순환하니까 count를 작은 양수로 변환합니다.
   int _axis = static_cast<int>(axis);  // axis을 int로 사용하기 위함입니다.
 
   for (int i = 0; i < count; ++i) {
     // container에 회전을 알파벳으로 기록합니다.
     // solve()에서는 해법을 찾기 전 container를 초기화하여 오염을 막습니다.
-    container += color_char[_axis];
-    // 코너의 회전입니다.
-    uint8_t corner_pos_temp = corner_pos[corner_rotation_target[_axis][0]];
-    uint8_t corner_ori_temp = corner_ori[corner_rotation_target[_axis][0]];
-    for (int j = 0; j < 3; ++j) {
-      corner_pos[corner_rotation_target[_axis][j]] = corner_pos[corner_rotation_target[_axis][j + 1]];
-      corner_ori[corner_rotation_target[_axis][j]] = (corner_ori[corner_rotation_target[_axis][j + 1]] + corner_ori_delta[_axis][j]) % 3;
-    }
-    corner_pos[corner_rotation_target[_axis][3]] = corner_pos_temp;
-    corner_ori[corner_rotation_target[_axis][3]] = (corner_ori_temp + corner_ori_delta[_axis][3]) % 3;
-    // 엣지의 회전입니다.
-    uint8_t edge_pos_temp = edge_pos[edge_rotation_target[_axis][0]];
-    uint8_t edge_ori_temp = edge_ori[edge_rotation_target[_axis][0]];
-    for (int j = 0; j < 3; ++j) {
-      edge_pos[edge_rotation_target[_axis][j]] = edge_pos[edge_rotation_target[_axis][j + 1]];
-      edge_ori[edge_rotation_target[_axis][j]] = edge_ori[edge_rotation_target[_axis][j + 1]] ^ edge_ori_flip[_axis];
-    }
-    edge_pos[edge_rotation_target[_axis][3]] = edge_pos_temp;
-    edge_ori[edge_rotation_target[_axis][3]] = edge_ori_temp ^ edge_ori_flip[_axis];
-  }
-}
-// 오른손 트위스트를 수행하는 함수입니다.
-inline void twist_rhand(Color top, Color right) {
-  rotate(right, 1);
-  rotate(top, 1);
-  rotate(right, -1);
-  rotate(top, -1);
-}
-// 왼손 트위스트를 수행하는 함수입니다.
-inline void twist_lhand(Color top, Color left) {
-  rotate(left, -1);
-  rotate(top, -1);
-  rotate(left, 1);
-  rotate(top, 1);
+    container.append(color_char[_axis]);
+    cube.turn(_axis);
+  }
 }
 /* 3. 그 긴거 (큐브를 해결하는 방법을 구하는 함수)
  *    아무래도 505줄짜리 함수를 PPT에 담는 건 어렵지 않나 싶습니다.   
  * 
  * 해법은 container에 저장됩니다.
  * 알파벳은 각각의 축을 의미하며 대문자는 시계방향, 소문자는 반시계방향입니다.
+ * 마지막 단계의 정리를 거치면 180도 회전은 축 번호 숫자(half_turn_char) 한 글자가 됩니다.
  * 
  * 원리는 아래 링크를 참고 바랍니다.
  * >> https://www.youtube.com/watch?v=HgEySd_N-6w
  */
-void solve() {
-  container = "";
-  constexpr Color colors_tmp[4] = {
-    Color::G,
-    Color::R,
-    Color::B,
-    Color::O,
-  };
+constexpr Color side_colors[4] = {  // 흰 면에서 보았을 때 옆면들의 순서입니다.
+  Color::G,
+  Color::R,
+  Color::B,
+  Color::O,
+};
+/* 흰 십자가 표
+ *
+ * 흰 엣지 0..3의 자리(12 * 11 * 10 * 9)와 방향(2^4)을 묶은 190,080가지 상태마다 흰 십자가까지의 최소 면 회전 수(0~8)를
+ * 4비트씩(짝수 번호가 아래 4비트) 담은 95,040바이트 표입니다. host/cross_gen.cpp가 rotate()와 같은 회전 모델로 BFS를 돌려 만듭니다.
+ * 표가 있으면 1단계는 18가지 회전 중 거리를 하나 줄이는 회전을 골라 돌리기를 반복해서 최적의 흰 십자가(8회 이하)를 만듭니다.
+ *   호스트            cross_gen이 쓴 파일을 host/CrossFile.h의 cross_table_load()로 읽어 cross_table에 연결합니다.
+ *   ATmega1280/2560  스케치에서 CUBE_CROSS_TABLE을 1로 정의하면 cross_gen --header로 만든 CrossTable.h를 PROGMEM에 둡니다.
+ *                    64KB를 넘으므로 far 주소로 읽고, 배열 하나가 32KB를 넘을 수 없어서 CROSS_TABLE_PART 바이트씩 세 개로 나눕니다.
+ * 표가 없으면(Uno 등 플래시가 작은 보드의 기본값) 아래의 자리별 회전 패턴으로 맞춥니다.
+ */
+constexpr uint32_t CROSS_TABLE_COUNT = 190080;
+constexpr uint32_t CROSS_TABLE_SIZE = CROSS_TABLE_COUNT / 2;
+constexpr uint8_t CROSS_MAX_DISTANCE = 8;
+
+#if !defined(__AVR__)
+const uint8_t* cross_table = nullptr;
+inline bool cross_table_ready() {
+  return cross_table != nullptr;
+}
+inline uint8_t cross_table_byte(uint32_t offset) {
+  return cross_table[offset];
+}
+#else
+#ifndef CUBE_CROSS_TABLE
+#define CUBE_CROSS_TABLE 0
+#endif
+#if CUBE_CROSS_TABLE
+#include "CrossTable.h"
+inline bool cross_table_ready() {
+  return true;
+}
+inline uint8_t cross_table_byte(uint32_t offset) {
+  if (offset < CROSS_TABLE_PART) {
+    return pgm_read_byte_far(pgm_get_far_address(cross_table_0) + offset);
+  } else if (offset < 2 * CROSS_TABLE_PART) {
+    return pgm_read_byte_far(pgm_get_far_address(cross_table_1) + offset - CROSS_TABLE_PART);
+  }
+  return pgm_read_byte_far(pgm_get_far_address(cross_table_2) + offset - 2 * CROSS_TABLE_PART);
+}
+#else
+inline bool cross_table_ready() {
+  return false;
+}
+inline uint8_t cross_table_byte(uint32_t) {
+  return 0;
+}
+#endif
+#endif
 
-  // 1. 흰 십자가 맞추기
+inline uint32_t cross_index(const CubeState& state) {
+  uint8_t positions[4], orientations = 0;
+  for (uint8_t pos = 0; pos < 12; ++pos) {
+    uint8_t piece = state.edge_pos(pos);
+    if (piece < 4) {
+      positions[piece] = pos;
+      orientations |= state.edge_ori(pos) << piece;
+    }
+  }
+  uint32_t index = 0;
+  for (uint8_t i = 0; i < 4; ++i) {  // 앞의 조각이 차지한 자리를 뺀 순위로 12 * 11 * 10 * 9가지를 셉니다.
+    uint8_t rank = positions[i];
+    for (uint8_t j = 0; j < i; ++j) {
+      rank -= positions[j] < positions[i];
+    }
+    index = index * (12 - i) + rank;
+  }
+  return index * 16 + orientations;
+}
+inline uint8_t cross_distance(const CubeState& state) {
+  uint32_t index = cross_index(state);
+  return cross_table_byte(index / 2) >> (index % 2 * 4) & 15;
+}
+// 표를 따라 최적의 흰 십자가를 만듭니다. 매번 거리가 하나씩 줄어들므로 많아야 CROSS_MAX_DISTANCE번 돕니다.
+void solve_white_cross_table() {
+  for (uint8_t distance = cross_distance(cube); distance != 0; --distance) {
+    for (uint8_t move = 0; move < MOVE_COUNT; ++move) {
+      CubeState next = cube;
+      turn_cube_move(next, move);
+      if (cross_distance(next) == distance - 1) {
+        rotate(static_cast<Color>(move_axis(move)), move_count(move));
+        break;
+      }
+    }
+  }
+}
+// 1. 흰 십자가 맞추기
+void solve_white_cross() {
+  if (cross_table_ready()) {
+    solve_white_cross_table();
+    return;
+  }
   for (bool white_edge_to_move_exist = false;; white_edge_to_move_exist = false) {
+    SOLVE_LOOP_HOOK(SOLVE_LOOP_WHITE_CROSS);
     for (uint8_t pos = 0; pos < 12; ++pos) {
-      uint8_t nxt_pos = edge_pos[pos];
+      uint8_t nxt_pos = cube.edge_pos(pos);
       if (nxt_pos != 0 && nxt_pos != 1 && nxt_pos != 2 && nxt_pos != 3) {
         continue;
       }
 
-      if (edge_ori[pos] == 0 && nxt_pos == pos) {
+      if (cube.edge_ori(pos) == 0 && nxt_pos == pos) {
         continue;
       }
 
@@ -171,22 +500,22 @@ void solve() {
         case 2:
         case 3:
           {
-            if (edge_ori[pos] == 0) {
-              rotate(colors_tmp[pos], +1);
+            if (cube.edge_ori(pos) == 0) {
+              rotate(side_colors[pos], +1);
               rotate(Color::W, (4 + nxt_pos - pos) % 4 * +1);
-              rotate(colors_tmp[pos], -1);
+              rotate(side_colors[pos], -1);
               rotate(Color::W, (4 + nxt_pos - pos) % 4 * -1);
             } else {
-              rotate(colors_tmp[pos], +1);
+              rotate(side_colors[pos], +1);
               rotate(Color::W, (3 + nxt_pos - pos) % 4 * +1);
-              rotate(colors_tmp[(pos + 1) % 4], +1);
+              rotate(side_colors[(pos + 1) % 4], +1);
               rotate(Color::W, (3 + nxt_pos - pos) % 4 * -1);
             }
             break;
           }
         case 4:
           {
-            if (edge_ori[pos] == 0) {
+            if (cube.edge_ori(pos) == 0) {
               rotate(Color::W, (4 + nxt_pos - 0) % 4 * +1);
               rotate(Color::G, -1);
               rotate(Color::W, (4 + nxt_pos - 0) % 4 * -1);
@@ -199,7 +528,7 @@ void solve() {
           }
         case 5:
           {
-            if (edge_ori[pos] == 0) {
+            if (cube.edge_ori(pos) == 0) {
               rotate(Color::W, (4 + nxt_pos - 2) % 4 * +1);
               rotate(Color::B, +1);
               rotate(Color::W, (4 + nxt_pos - 2) % 4 * -1);
@@ -212,7 +541,7 @@ void solve() {
           }
         case 6:
           {
-            if (edge_ori[pos] == 0) {
+            if (cube.edge_ori(pos) == 0) {
               rotate(Color::W, (4 + nxt_pos - 2) % 4 * +1);
               rotate(Color::B, -1);
               rotate(Color::W, (4 + nxt_pos - 2) % 4 * -1);
@@ -225,7 +554,7 @@ void solve() {
           }
         case 7:
           {
-            if (edge_ori[pos] == 0) {
+            if (cube.edge_ori(pos) == 0) {
               rotate(Color::W, (4 + nxt_pos - 0) % 4 * +1);
               rotate(Color::G, +1);
               rotate(Color::W, (4 + nxt_pos - 0) % 4 * -1);
@@ -241,9 +570,9 @@ void solve() {
         case 10:
         case 11:
           {
-            if (edge_ori[pos] == 0) {
+            if (cube.edge_ori(pos) == 0) {
               rotate(Color::Y, (12 + nxt_pos - pos) % 4);
-              rotate(colors_tmp[nxt_pos], 2);
+              rotate(side_colors[nxt_pos], 2);
             } else {
               switch ((12 + nxt_pos - pos) % 4) {
                 case 0:
@@ -257,14 +586,14 @@ void solve() {
               switch ((12 + nxt_pos - pos) % 4) {
                 case 1:
                   {
-                    rotate(colors_tmp[(pos + 0) % 4], -1);
-                    rotate(colors_tmp[(pos + 1) % 4], +1);
+                    rotate(side_colors[(pos + 0) % 4], -1);
+                    rotate(side_colors[(pos + 1) % 4], +1);
                     break;
                   }
                 case 3:
                   {
-                    rotate(colors_tmp[(pos + 0) % 4], +1);
-                    rotate(colors_tmp[(pos + 3) % 4], -1);
+                    rotate(side_colors[(pos + 0) % 4], +1);
+                    rotate(side_colors[(pos + 3) % 4], -1);
                     break;
                   }
               }
@@ -278,374 +607,474 @@ void solve() {
       break;
     }
   }
+}
+/* 두 층 표
+ *
+ * 흰 십자가를 맞춘 뒤에는 칸(slot)마다 흰 코너와 가운데 엣지를 한 쌍으로 넣습니다(F2L).
+ * 칸 s는 코너 자리 s와 엣지 자리 4 + s이며, side_colors[s]와 side_colors[s + 1] 사이에 있습니다.
+ * 회전열 번호(매크로)는 아래와 같습니다. 트리거는 옆면 하나를 돌려 칸 하나를 노란 층으로 올렸다가 되돌리므로 그 칸과 노란 층만 바꿉니다.
+ *   0..2   노란 면 회전 Y^(번호 + 1)
+ *   3..26  트리거 X^d Y^k X^-d. 번호 - 3을 t라 하면 X는 side_colors[t / 6], d는 t / 3이 짝수면 +1(홀수면 -1), k는 t % 3 + 1
+ * 표는 칸 0의 경우(코너 자리 8 * 방향 3, 엣지 자리 4..11 * 방향 2 = 384칸)마다 다음 매크로를 담고, FIRST_TWO_LAYERS_DONE이면 맞춰졌습니다.
+ * 다른 칸은 옆면 축을 side_colors 순서로 s칸 돌려 칸 0과 같게 보고 찾습니다. 엣지 방향은 L/R 회전에서만 바뀌므로 돌려도 그대로가 아니어서,
+ * first_two_layers_corner_case/edge_case가 칸마다 실제 자리와 방향을 칸 0의 경우 번호로 바꿉니다.
+ * 표는 host/first_two_layers_gen.cpp가 맞춰진 쌍에서 거꾸로 Dijkstra를 돌려 만들며, 그 칸의 트리거와 쌍의 조각이 들어 있는 칸의 트리거만 씁니다.
+ * 따라서 이미 맞춘 칸은 건드리지 않고, 칸 하나는 많아야 FIRST_TWO_LAYERS_STEPS개의 매크로로 끝납니다.
+ * 남은 칸마다 표를 따라가는 면 회전 수를 복사본으로 세어 가장 적은 칸부터 맞춥니다.
+ */
+constexpr uint8_t FIRST_TWO_LAYERS_DONE = 0xFF;
+constexpr uint16_t FIRST_TWO_LAYERS_COUNT = 384;
 
-  // 2. 흰 면 맞추기
-  for (bool white_corner_to_move_exist = false;; white_corner_to_move_exist = false) {
-    for (uint8_t pos = 0; pos < 8; ++pos) {
-      uint8_t nxt_pos = corner_pos[pos];
-      if (nxt_pos != 0 && nxt_pos != 1 && nxt_pos != 2 && nxt_pos != 3) {
-        continue;
-      }
+#ifndef FIRST_TWO_LAYERS_NO_TABLES
+#include "FirstTwoLayersTables.h"
+#endif
 
-      if (corner_ori[pos] == 0 && nxt_pos == pos) {
-        continue;
+inline uint16_t first_two_layers_index(const CubeState& state, uint8_t slot) {
+  uint8_t corner = 0, edge = 0;
+  for (uint8_t pos = 0; pos < 8; ++pos) {
+    if (state.corner_pos(pos) == slot) {
+      corner = pgm_read_byte(&first_two_layers_corner_case[slot * 24 + pos * 3 + state.corner_ori(pos)]);
+    }
+  }
+  for (uint8_t pos = 4; pos < 12; ++pos) {
+    if (state.edge_pos(pos) == 4 + slot) {
+      edge = pgm_read_byte(&first_two_layers_edge_case[slot * 16 + (pos - 4) * 2 + state.edge_ori(pos)]);
+    }
+  }
+  return corner * 16 + edge;
+}
+// 칸 slot에서 매크로 하나의 회전 번호(axis * 3 + count - 1)를 moves에 쓰고 개수를 반환합니다.
+inline uint8_t first_two_layers_moves(uint8_t macro, uint8_t slot, uint8_t moves[3]) {
+  constexpr uint8_t yellow = static_cast<uint8_t>(Color::Y) * 3;
+  if (macro < 3) {
+    moves[0] = yellow + macro;
+    return 1;
+  }
+  macro -= 3;
+  uint8_t side = static_cast<uint8_t>(side_colors[(macro / 6 + slot) % 4]) * 3;
+  uint8_t lift = macro / 3 % 2 == 0 ? 0 : 2;  // count - 1이 0이면 시계방향, 2면 반시계방향
+  moves[0] = side + lift;
+  moves[1] = yellow + macro % 3;
+  moves[2] = side + 2 - lift;
+  return 3;
+}
+// 복사본에서 칸 slot을 표대로 맞추는 데 드는 면 회전 수입니다. 0이면 이미 맞춰져 있습니다.
+inline uint8_t first_two_layers_cost(CubeState state, uint8_t slot) {
+  uint8_t cost = 0;
+  for (uint8_t step = 0; step < FIRST_TWO_LAYERS_STEPS; ++step) {
+    uint8_t macro = pgm_read_byte(&first_two_layers_table[first_two_layers_index(state, slot)]);
+    if (macro == FIRST_TWO_LAYERS_DONE) {
+      break;
+    }
+    uint8_t moves[3];
+    uint8_t count = first_two_layers_moves(macro, slot, moves);
+    for (uint8_t i = 0; i < count; ++i) {
+      turn_cube_move(state, moves[i]);
+    }
+    cost += count;
+  }
+  return cost;
+}
+// 2. 두 층 맞추기(흰 코너와 가운데 엣지를 한 쌍씩)
+void solve_first_two_layers() {
+  for (uint8_t pass = 0; pass < 4; ++pass) {  // 한 번에 한 칸씩 맞추므로 만들 수 없는 상태에서도 네 번이면 끝납니다.
+    SOLVE_LOOP_HOOK(SOLVE_LOOP_PAIR_SLOTS);
+    uint8_t best_slot = 4, best_cost = 0xFF;
+    for (uint8_t slot = 0; slot < 4; ++slot) {
+      uint8_t cost = first_two_layers_cost(cube, slot);
+      if (cost != 0 && cost < best_cost) {
+        best_slot = slot;
+        best_cost = cost;
       }
+    }
+    if (best_slot == 4) {
+      break;
+    }
 
-      white_corner_to_move_exist = true;
-
-      switch (pos) {
-        case 0:
-        case 1:
-        case 2:
-        case 3:
-          {
-            if (corner_ori[pos] == 0 || corner_ori[pos] == 1) {
-              rotate(colors_tmp[(pos + 1) % 4], -1);
-              rotate(Color::Y, -1);
-              rotate(colors_tmp[(pos + 1) % 4], +1);
-              pos = (pos + 3) % 4 + 4;
-            } else {
-              rotate(colors_tmp[(pos + 0) % 4], +1);
-              rotate(Color::Y, +1);
-              rotate(colors_tmp[(pos + 0) % 4], -1);
-              pos = (pos + 1) % 4 + 4;
-            }
-            break;
-          }
-        case 4:
-        case 5:
-        case 6:
-        case 7:
-          {
-            if (corner_ori[pos] == 0) {
-              uint8_t top_pos = (pos + 1) % 4;
-              uint8_t top_rotation_count = 0;
-              while (corner_pos[top_pos] == 0 || corner_pos[top_pos] == 1 || corner_pos[top_pos] == 2 || corner_pos[top_pos] == 3) {
-                rotate(Color::W, 1);
-                top_rotation_count++;
-              }
-
-              rotate(colors_tmp[(top_pos + 1) % 4], -1);
-              rotate(Color::Y, 2);
-              rotate(colors_tmp[(top_pos + 1) % 4], +1);
-
-              rotate(Color::W, -top_rotation_count);
-
-              pos = top_pos + 4;
-            }
-
-            break;
-          }
+    for (uint8_t step = 0; step < FIRST_TWO_LAYERS_STEPS; ++step) {
+      uint8_t macro = pgm_read_byte(&first_two_layers_table[first_two_layers_index(cube, best_slot)]);
+      if (macro == FIRST_TWO_LAYERS_DONE) {
+        break;
       }
-
-      switch (pos) {
-        case 4:
-        case 5:
-        case 6:
-        case 7:
-          {
-            if (corner_ori[pos] == 1) {
-              while (corner_pos[(nxt_pos + 3) % 4 + 4] != nxt_pos) {
-                rotate(Color::Y, 1);
-              }
-
-              rotate(colors_tmp[(nxt_pos + 1) % 4], -1);
-              rotate(Color::Y, +1);
-              rotate(colors_tmp[(nxt_pos + 1) % 4], +1);
-            } else if (corner_ori[pos] == 2) {
-              while (corner_pos[(nxt_pos + 1) % 4 + 4] != nxt_pos) {
-                rotate(Color::Y, 1);
-              }
-
-              rotate(colors_tmp[(nxt_pos + 0) % 4], +1);
-              rotate(Color::Y, -1);
-              rotate(colors_tmp[(nxt_pos + 0) % 4], -1);
-            }
-          }
+      SOLVE_LOOP_HOOK(SOLVE_LOOP_PAIR_MACROS);
+      uint8_t moves[3];
+      uint8_t count = first_two_layers_moves(macro, best_slot, moves);
+      for (uint8_t i = 0; i < count; ++i) {
+        rotate(static_cast<Color>(move_axis(moves[i])), move_count(moves[i]));
       }
+    }
+  }
+}
+/* 마지막 층 표
+ *
+ * 두 층을 맞춘 뒤에는 LastLayerTables.h의 표에서 다음 알고리즘을 찾아 수행합니다(방향과 위치를 나눈 2-look).
+ *   방향 표(3단계)  코너 4..6의 방향(3진수) * 8 + 엣지 8..10의 방향(2진수), 216칸. 코너 7과 엣지 11의 방향은 합으로 정해집니다.
+ *   위치 표(4단계)  코너 4..7의 순열 번호 * 12 + 엣지 8..11의 순열 번호 / 2, 288칸. 코너와 엣지 순열의 홀짝이 같으므로 엣지 번호의 마지막 비트는 정해집니다.
+ * 칸 값의 위 4비트는 알고리즘 번호 + 1(0이면 알고리즘 없이 노란 면만 돌립니다), 가운데 2비트는 알고리즘의 옆면 축을
+ * side_colors 순서로 돌려 쓸 칸 수(y 회전), 아래 2비트는 알고리즘 앞에 노란 면을 돌릴 횟수입니다. LAST_LAYER_DONE이면 그 단계가 끝났습니다.
+ * 표는 host/last_layer_gen.cpp가 잘 알려진 OLL/PLL 알고리즘의 y 회전과 노란 면 회전을 간선으로 한 Dijkstra로 만들므로,
+ * 칸을 따라가면 면 회전 수가 가장 적은 조합으로 끝납니다. 단계마다 알고리즘은 많아야 LAST_LAYER_*_STEPS개이며,
+ * 만들 수 없는 상태(센서 오류 등)에서는 표가 끝나지 않을 수 있으므로 그만큼만 따라갑니다.
+ */
+constexpr uint8_t LAST_LAYER_DONE = 0xFF;
+constexpr uint16_t LAST_LAYER_ORIENTATION_COUNT = 216;
+constexpr uint16_t LAST_LAYER_PERMUTATION_COUNT = 288;
+
+#ifndef LAST_LAYER_NO_TABLES
+#include "LastLayerTables.h"
+#endif
 
+inline uint8_t last_layer_orientation_index(const CubeState& state) {
+  return ((state.corner_ori(4) * 3 + state.corner_ori(5)) * 3 + state.corner_ori(6)) * 8
+         + (state.edge_ori(8) << 2 | state.edge_ori(9) << 1 | state.edge_ori(10));
+}
+// 0..3을 한 번씩 담은 배열의 사전순 순열 번호(0..23)입니다.
+inline uint8_t last_layer_rank(const uint8_t values[4]) {
+  uint8_t rank = 0;
+  for (uint8_t i = 0; i < 3; ++i) {
+    uint8_t smaller = 0;
+    for (uint8_t j = i + 1; j < 4; ++j) {
+      smaller += values[j] < values[i];
+    }
+    rank = rank * (4 - i) + smaller;
+  }
+  return rank;
+}
+inline uint16_t last_layer_permutation_index(const CubeState& state) {
+  uint8_t corners[4], edges[4];
+  for (uint8_t i = 0; i < 4; ++i) {
+    corners[i] = state.corner_pos(4 + i) - 4;
+    edges[i] = state.edge_pos(8 + i) - 8;
+  }
+  return last_layer_rank(corners) * 12 + last_layer_rank(edges) / 2;
+}
+// 옆면 축을 side_colors 순서로 rotation칸 돌립니다. W, Y는 그대로입니다.
+inline uint8_t last_layer_axis(uint8_t axis, uint8_t rotation) {
+  for (uint8_t side = 0; side < 4; ++side) {
+    if (static_cast<uint8_t>(side_colors[side]) == axis) {
+      return static_cast<uint8_t>(side_colors[(side + rotation) % 4]);
+    }
+  }
+  return axis;
+}
+// 표의 칸 하나(entry)를 수행합니다. first는 그 표의 알고리즘 0번이 last_layer_begin에서 몇 번째인지입니다.
+inline void last_layer_perform(uint8_t entry, uint8_t first) {
+  rotate(Color::Y, entry & 3);
+  if (entry >> 4 == 0) {
+    return;
+  }
+  uint8_t algorithm = first + (entry >> 4) - 1;
+  uint8_t end = pgm_read_byte(&last_layer_begin[algorithm + 1]);
+  for (uint8_t i = pgm_read_byte(&last_layer_begin[algorithm]); i < end; ++i) {
+    uint8_t move = pgm_read_byte(&last_layer_moves[i]);
+    rotate(static_cast<Color>(last_layer_axis(move_axis(move), entry >> 2 & 3)), move_count(move));
+  }
+}
+// 3. 노란 면 맞추기(마지막 층의 방향)
+void solve_last_layer_orientation() {
+  for (uint8_t step = 0; step < LAST_LAYER_ORIENTATION_STEPS; ++step) {
+    uint8_t entry = pgm_read_byte(&last_layer_orientation_table[last_layer_orientation_index(cube)]);
+    if (entry == LAST_LAYER_DONE) {
       break;
     }
-
-    if (white_corner_to_move_exist == false) {
+    SOLVE_LOOP_HOOK(SOLVE_LOOP_ORIENTATION);
+    last_layer_perform(entry, 0);
+  }
+}
+// 4. 전체 맞추기(마지막 층의 위치)
+void solve_last_layer_permutation() {
+  for (uint8_t step = 0; step < LAST_LAYER_PERMUTATION_STEPS; ++step) {
+    uint8_t entry = pgm_read_byte(&last_layer_permutation_table[last_layer_permutation_index(cube)]);
+    if (entry == LAST_LAYER_DONE) {
       break;
     }
+    SOLVE_LOOP_HOOK(SOLVE_LOOP_PERMUTATION);
+    last_layer_perform(entry, LAST_LAYER_PERMUTATION_FIRST);
   }
+}
 
-  // 3. 두 층 맞추기
-  for (bool side_edge_to_move_exist = false;; side_edge_to_move_exist = false) {
-    for (int8_t pos = 11; pos >= 0; --pos) {
-      uint8_t nxt_pos = edge_pos[pos];
-      if (nxt_pos != 4 && nxt_pos != 5 && nxt_pos != 6 && nxt_pos != 7) {
-        continue;
-      }
-
-      if (edge_ori[pos] == 0 && nxt_pos == pos) {
-        continue;
-      }
-
-      side_edge_to_move_exist = true;
-
-      switch (pos) {
-        case 0:
-        case 1:
-        case 2:
-        case 3:
-          {
-            break;
-          }
-        case 4:
-        case 5:
-        case 6:
-        case 7:
-          {
-            twist_rhand(Color::Y, colors_tmp[(pos + 0) % 4]);
-            twist_lhand(Color::Y, colors_tmp[(pos + 1) % 4]);
-            break;
-          }
-        case 8:
-        case 9:
-        case 10:
-        case 11:
-          {
-            constexpr uint8_t mid_poses[2][4] = {
-              { 11, 11, 9, 9 },
-              { 10, 8, 8, 10 },
-            };
-            uint8_t mid_pos = mid_poses[edge_ori[pos]][nxt_pos - 4];
-            rotate(Color::Y, (4 + mid_pos - pos) % 4);
+// solve()의 stage(1~SOLVE_FINAL_STAGE)단계를 수행합니다. 단계마다 따로 부를 수 있어서 여러 루프에 나눠 풀 때 사용합니다.
+constexpr uint8_t SOLVE_FINAL_STAGE = 5;
+void solve_stage(uint8_t stage) {
+  switch (stage) {
+    case 1: solve_white_cross(); break;
+    case 2: solve_first_two_layers(); break;
+    case 3: solve_last_layer_orientation(); break;
+    case 4: solve_last_layer_permutation(); break;
+    case 5: optimize_moves(container); break;  // 중복 회전 정리(Ww >> void, WWW >> w, WYW >> WWY)
+  }
+}
+void solve() {
+  container.clear();
+  for (uint8_t stage = 1; stage <= SOLVE_FINAL_STAGE; ++stage) {
+    SOLVE_STAGE_HOOK(stage);
+    solve_stage(stage);
+  }
+  SOLVE_STAGE_HOOK(SOLVE_FINAL_STAGE + 1);
+}
 
-            if ((8 + nxt_pos - mid_pos) % 4 == 1) {
-              twist_lhand(Color::Y, colors_tmp[(nxt_pos + 1) % 4]);
-              twist_rhand(Color::Y, colors_tmp[(nxt_pos + 0) % 4]);
-            } else if ((8 + nxt_pos - mid_pos) % 4 == 2) {
-              twist_rhand(Color::Y, colors_tmp[(nxt_pos + 0) % 4]);
-              twist_lhand(Color::Y, colors_tmp[(nxt_pos + 1) % 4]);
-            }
-            break;
-          }
-      }
+/* 색 중립 해법
+ *
+ * solve()는 흰 면을 위, 노란 면을 아래에 두고 옆면을 side_colors 순서로 보는 한 가지 시점에서만 풉니다.
+ * 같은 상태도 큐브를 다르게 잡은 시점에서 풀면 더 짧은 경우가 많으므로, 큐브 전체의 대칭(회전 24가지, 거울상 24가지)마다
+ * 상태를 그 시점으로 바꿔 풀고 회전을 원래 축으로 되돌린 뒤 면 회전이 가장 적은 해법을 고릅니다.
+ *
+ * 대칭은 면의 대응 axis[6](면 a가 면 axis[a]로 감)이며, 마주 보는 면 쌍(W/Y, G/B, O/R)은 쌍끼리 대응합니다.
+ * 대응의 행렬식이 -1이면 거울상이고, 시계방향 회전이 반시계방향 회전에 대응합니다. 번호 0..23은 회전(0은 그대로), 24..47은 거울상입니다.
+ * 조각의 자리 대응은 회전 표(corner/edge_rotation_target)에서 자리마다 걸친 면들을 대응시켜 찾고, 방향 보정(twist, flip)은
+ * "맞춰진 큐브에 면 a를 돌린 상태는 면 axis[a]를 돌린 상태에 대응한다"는 조건을 자리 0부터 퍼뜨려서 구합니다.
+ * 자리 p의 조각 x(방향 o)는 자리 corner_pos[p]의 조각 corner_pos[x]가 되고, 방향은 o + twist[p] - twist[x]입니다(거울상은 -o).
+ *
+ * solve_in_frame()은 cube를 대칭 하나의 시점에서 풀고 container에 원래 축의 해법을 남깁니다.
+ * 대칭을 만들 수 없으면(cube_symmetry()가 false) 원래 시점에서 solve()로 풀고 false를 반환하므로, 부르는 쪽은 그 해법을 후보로 세지 않습니다.
+ * solve_color_neutral(frames)는 대칭 0..frames-1을 차례로 풀어 가장 짧은 해법(같으면 번호가 작은 쪽)을 남기고 그 번호를 반환합니다.
+ * 가장 짧은 해법을 따로 복사해 두지 않고 번호만 기억했다가 다시 풀어서 RAM을 더 쓰지 않습니다.
+ * 장치에서는 PhysicalCube.h의 미리 풀기가 CUBE_NEUTRAL_FRAMES개까지 남는 시간 동안 한 시점씩 풀고,
+ * 호스트에서는 host/ColorNeutral.h가 시점들을 여러 스레드에 나눠 풉니다.
+ */
+constexpr uint8_t CUBE_SYMMETRY_COUNT = 48;
+constexpr uint8_t CUBE_ROTATION_COUNT = 24;
+struct CubeSymmetry {
+  uint8_t axis[6];
+  bool mirror;
+  uint8_t corner_pos[8];
+  uint8_t corner_twist[8];
+  uint8_t edge_pos[12];
+  uint8_t edge_flip[12];
+};
+// 면 쌍의 순열 6가지입니다. 홀수 순열(parity 1)은 행렬식의 부호를 바꿉니다.
+constexpr uint8_t symmetry_pair_order[6][3] = {
+  { 0, 1, 2 }, { 0, 2, 1 }, { 1, 0, 2 }, { 1, 2, 0 }, { 2, 0, 1 }, { 2, 1, 0 },
+};
+constexpr uint8_t symmetry_pair_parity[6] = { 0, 1, 1, 0, 0, 1 };
+// 자리 pos가 걸친 면들을 비트로 반환합니다.
+inline uint8_t symmetry_faces(const uint8_t (*target)[4], uint8_t pos) {
+  uint8_t faces = 0;
+  for (uint8_t axis = 0; axis < 6; ++axis) {
+    for (uint8_t j = 0; j < 4; ++j) {
+      faces |= (target[axis][j] == pos) << axis;
     }
-
-    if (side_edge_to_move_exist == false) {
-      break;
+  }
+  return faces;
+}
+// 걸친 면들을 대칭으로 옮긴 자리를 찾습니다.
+inline uint8_t symmetry_position(const CubeSymmetry& symmetry, const uint8_t (*target)[4], uint8_t count, uint8_t pos) {
+  uint8_t faces = symmetry_faces(target, pos), mapped = 0;
+  for (uint8_t axis = 0; axis < 6; ++axis) {
+    mapped |= (faces >> axis & 1) << symmetry.axis[axis];
+  }
+  for (uint8_t other = 0; other < count; ++other) {
+    if (symmetry_faces(target, other) == mapped) {
+      return other;
     }
   }
-
-  // 4. 노란 십자가 맞추기
-  {
-    if (edge_ori[8] == 0 && edge_ori[9] == 0 && edge_ori[10] == 0 && edge_ori[11] == 0)
-      ;                                                                                         // 행복한 경우
-    else if (edge_ori[8] == 1 && edge_ori[9] == 1 && edge_ori[10] == 1 && edge_ori[11] == 1) {  // .
-      rotate(Color::G, +1);
-      twist_rhand(Color::Y, Color::O);
-      rotate(Color::G, -1);
-    } else if (edge_ori[8] == 0 && edge_ori[10] == 0) {  // |
-      rotate(Color::O, +1);
-      twist_rhand(Color::Y, Color::B);
-      rotate(Color::O, -1);
-    } else if (edge_ori[9] == 0 && edge_ori[11] == 0) {  // -
-      rotate(Color::G, +1);
-      twist_rhand(Color::Y, Color::O);
-      rotate(Color::G, -1);
+  return 0;
+}
+// 대칭 index(0..CUBE_SYMMETRY_COUNT-1)를 만듭니다. 방향 보정이 모든 회전과 맞지 않으면 false를 반환합니다.
+inline bool cube_symmetry(uint8_t index, CubeSymmetry& symmetry) {
+  // 면 쌍의 순열 6가지 * 쌍 안의 뒤집기 8가지 중, 회전(또는 거울상)만 세어 index % 24번째를 고릅니다.
+  symmetry = CubeSymmetry();
+  uint8_t rank = index % CUBE_ROTATION_COUNT;
+  for (uint8_t candidate = 0; candidate < CUBE_SYMMETRY_COUNT; ++candidate) {
+    uint8_t order = candidate / 8, swaps = candidate % 8;
+    bool mirror = (symmetry_pair_parity[order] + (swaps & 1) + (swaps >> 1 & 1) + (swaps >> 2)) % 2 == 1;
+    if (mirror != (index >= CUBE_ROTATION_COUNT) || rank-- != 0) {
+      continue;
     }
-
-    if (edge_ori[8] == 0 && edge_ori[9] == 0 && edge_ori[10] == 0 && edge_ori[11] == 0)
-      ;     // 행복한 경우
-    else {  // ㄱ
-      for (uint8_t i = 0; i < 4; ++i) {
-        if (edge_ori[8 + (i + 0) % 4] == 0 && edge_ori[8 + (i + 1) % 4] == 0) {
-          rotate(colors_tmp[(i + 3) % 4], +1);
-          twist_rhand(Color::Y, colors_tmp[(i + 2) % 4]);
-          twist_rhand(Color::Y, colors_tmp[(i + 2) % 4]);
-          rotate(colors_tmp[(i + 3) % 4], -1);
-          break;
-        }
-      }
+    symmetry.mirror = mirror;
+    for (uint8_t axis = 0; axis < 6; ++axis) {
+      symmetry.axis[axis] = symmetry_pair_order[order][axis / 2] * 2 + (axis % 2 ^ (swaps >> (axis / 2) & 1));
     }
+    break;
+  }
+  for (uint8_t pos = 0; pos < 8; ++pos) {
+    symmetry.corner_pos[pos] = symmetry_position(symmetry, corner_rotation_target, 8, pos);
+  }
+  for (uint8_t pos = 0; pos < 12; ++pos) {
+    symmetry.edge_pos[pos] = symmetry_position(symmetry, edge_rotation_target, 12, pos);
   }
 
-  // 5. 노란 코너 위치 맞추기
-  for (bool yello_face_will_rotate = true, yello_face_rotated = false;;
-       yello_face_will_rotate = true, yello_face_rotated = false) {
-    for (uint8_t i = 0; i < 4; ++i, rotate(Color::Y, 1)) {
-      if (corner_pos[4] == 4 && corner_pos[5] == 5 && corner_pos[6] == 6 && corner_pos[7] == 7) {  // 행복한 경우
-        yello_face_will_rotate = false;
-        break;
+  // 자리 0의 보정을 0으로 두고, 더 알아낼 것이 없을 때까지 회전마다 이웃한 자리로 퍼뜨립니다.
+  // 마지막 반복은 알려진 자리들만 다시 확인하므로 모든 조건을 검사한 것이 됩니다.
+  uint8_t corner_known = 1;
+  uint16_t edge_known = 1;
+  symmetry.corner_twist[0] = 0;
+  symmetry.edge_flip[0] = 0;
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (uint8_t axis = 0; axis < 6; ++axis) {
+      CubeState turned, mapped;
+      turned.turn(axis);
+      for (uint8_t i = 0; i < (symmetry.mirror ? 3 : 1); ++i) {
+        mapped.turn(symmetry.axis[axis]);
       }
-
       for (uint8_t j = 0; j < 4; ++j) {
-        if (corner_pos[4 + (j + 0) % 4] == 4 + (j + 0) % 4 && corner_pos[4 + (j + 1) % 4] == 4 + (j + 1) % 4) {
-          Color twist_r_side = colors_tmp[(j + 3) % 4];
-          twist_rhand(Color::Y, twist_r_side);
-          twist_rhand(Color::Y, twist_r_side);
-          twist_rhand(Color::Y, twist_r_side);
-          Color twist_l_side = colors_tmp[j];
-          twist_lhand(Color::Y, twist_l_side);
-          twist_lhand(Color::Y, twist_l_side);
-          twist_lhand(Color::Y, twist_l_side);
-
-          yello_face_rotated = true;
-          break;
+        uint8_t to = corner_rotation_target[axis][j], from = turned.corner_pos(to);
+        uint8_t ori = symmetry.mirror ? (3 - turned.corner_ori(to)) % 3 : turned.corner_ori(to);
+        uint8_t mapped_ori = mapped.corner_ori(symmetry.corner_pos[to]);
+        if (mapped.corner_pos(symmetry.corner_pos[to]) != symmetry.corner_pos[from]) {
+          return false;
+        }
+        if ((corner_known >> from & 1) && !(corner_known >> to & 1)) {
+          symmetry.corner_twist[to] = (mapped_ori + 3 - ori + symmetry.corner_twist[from]) % 3;
+          corner_known |= 1 << to;
+          changed = true;
+        } else if (!(corner_known >> from & 1) && (corner_known >> to & 1)) {
+          symmetry.corner_twist[from] = (symmetry.corner_twist[to] + ori + 3 - mapped_ori) % 3;
+          corner_known |= 1 << from;
+          changed = true;
+        } else if ((corner_known >> from & 1) && (ori + symmetry.corner_twist[to] + 3 - symmetry.corner_twist[from]) % 3 != mapped_ori) {
+          return false;
         }
-      }
 
-      if (yello_face_rotated == true) {
-        break;
+        to = edge_rotation_target[axis][j];
+        from = turned.edge_pos(to);
+        ori = turned.edge_ori(to) ^ mapped.edge_ori(symmetry.edge_pos[to]);
+        if (mapped.edge_pos(symmetry.edge_pos[to]) != symmetry.edge_pos[from]) {
+          return false;
+        }
+        if ((edge_known >> from & 1) != (edge_known >> to & 1)) {
+          uint8_t known = (edge_known >> from & 1) ? from : to;
+          symmetry.edge_flip[known == from ? to : from] = ori ^ symmetry.edge_flip[known];
+          edge_known |= 1 << from | 1 << to;
+          changed = true;
+        } else if ((edge_known >> from & 1) && (symmetry.edge_flip[from] ^ symmetry.edge_flip[to]) != ori) {
+          return false;
+        }
       }
     }
-
-    if (yello_face_will_rotate == false) {
-      break;
-    }
-    if (yello_face_rotated == false) {
-      twist_rhand(Color::Y, Color::O);
-      twist_rhand(Color::Y, Color::O);
-      twist_rhand(Color::Y, Color::O);
-      twist_lhand(Color::Y, Color::G);
-      twist_lhand(Color::Y, Color::G);
-      twist_lhand(Color::Y, Color::G);
-    }
   }
-
-  // 6. 노란 면 맞추기
-  for (uint8_t i = 0; i < 4; ++i) {
-    while (!(corner_pos[4] == 4 + i && corner_ori[4] == 0)) {
-      twist_rhand(Color::W, Color::R);
+  return corner_known == 0xFF && edge_known == 0xFFF;
+}
+// 상태를 대칭의 시점으로 옮깁니다. 상태에 면 a를 돌리는 것은 옮긴 상태에 면 axis[a]를 돌리는 것(거울상은 반대 방향)과 같습니다.
+inline CubeState symmetry_conjugate(const CubeSymmetry& symmetry, const CubeState& state) {
+  CubeState result;
+  for (uint8_t pos = 0; pos < 8; ++pos) {
+    uint8_t piece = state.corner_pos(pos), ori = state.corner_ori(pos);
+    ori = symmetry.mirror ? (3 - ori) % 3 : ori;
+    result.set_corner(symmetry.corner_pos[pos], symmetry.corner_pos[piece],
+                      (ori + symmetry.corner_twist[pos] + 3 - symmetry.corner_twist[piece]) % 3);
+  }
+  for (uint8_t pos = 0; pos < 12; ++pos) {
+    uint8_t piece = state.edge_pos(pos);
+    result.set_edge(symmetry.edge_pos[pos], symmetry.edge_pos[piece],
+                    state.edge_ori(pos) ^ symmetry.edge_flip[pos] ^ symmetry.edge_flip[piece]);
+  }
+  return result;
+}
+// 대칭의 시점에서 구한 회전 번호를 원래 축의 회전 번호로 되돌립니다.
+inline uint8_t symmetry_physical_move(const CubeSymmetry& symmetry, uint8_t move) {
+  uint8_t axis = 0;
+  while (symmetry.axis[axis] != move_axis(move)) {
+    axis++;
+  }
+  uint8_t count = symmetry.mirror ? 4 - move_count(move) : move_count(move);
+  return axis * 3 + count - 1;
+}
+bool solve_in_frame(uint8_t index) {
+  CubeSymmetry symmetry;
+  if (!cube_symmetry(index, symmetry)) {
+    solve();
+    return false;
+  }
+  cube = symmetry_conjugate(symmetry, cube);  // 맞춰진 상태는 어느 시점에서도 맞춰진 상태이므로 푼 뒤의 cube는 그대로 둡니다.
+  solve();
+  for (uint16_t i = 0; i < container.length(); ++i) {
+    uint8_t axis, count;
+    if (parse_move_char(container[i], axis, count)) {
+      container[i] = move_char(symmetry_physical_move(symmetry, axis * 3 + count - 1));
     }
-    rotate(Color::Y, -1);
   }
-
-  // 7. 전체 맞추기
-  if (edge_pos[8] == 8 && edge_pos[9] == 9 && edge_pos[10] == 10 && edge_pos[11] == 11)
-    ;  // 행복한 경우
-  else {
-    if (edge_pos[8] != 8 && edge_pos[9] != 9 && edge_pos[10] != 10 && edge_pos[11] != 11) {  // 행복한 경우
-      twist_rhand(Color::Y, Color::O);
-      twist_lhand(Color::Y, Color::R);
-      twist_rhand(Color::Y, Color::O);
-      twist_rhand(Color::Y, Color::O);
-      twist_rhand(Color::Y, Color::O);
-      twist_rhand(Color::Y, Color::O);
-      twist_rhand(Color::Y, Color::O);
-      twist_lhand(Color::Y, Color::R);
-      twist_lhand(Color::Y, Color::R);
-      twist_lhand(Color::Y, Color::R);
-      twist_lhand(Color::Y, Color::R);
-      twist_lhand(Color::Y, Color::R);
-    }
-    for (uint8_t i = 0; i < 4; ++i) {
-      if (edge_pos[8 + i] == 8 + i) {
-        Color twist_r_side = colors_tmp[(i + 3) % 4];
-        Color twist_l_side = colors_tmp[(i + 1) % 4];
-        if (edge_pos[8 + (2 + i) % 4] == 8 + (3 + i) % 4) {
-          twist_lhand(Color::Y, twist_l_side);
-          twist_rhand(Color::Y, twist_r_side);
-          twist_lhand(Color::Y, twist_l_side);
-          twist_lhand(Color::Y, twist_l_side);
-          twist_lhand(Color::Y, twist_l_side);
-          twist_lhand(Color::Y, twist_l_side);
-          twist_lhand(Color::Y, twist_l_side);
-          twist_rhand(Color::Y, twist_r_side);
-          twist_rhand(Color::Y, twist_r_side);
-          twist_rhand(Color::Y, twist_r_side);
-          twist_rhand(Color::Y, twist_r_side);
-          twist_rhand(Color::Y, twist_r_side);
-        } else if (edge_pos[8 + (2 + i) % 4] == 8 + (1 + i) % 4) {
-          twist_rhand(Color::Y, twist_r_side);
-          twist_lhand(Color::Y, twist_l_side);
-          twist_rhand(Color::Y, twist_r_side);
-          twist_rhand(Color::Y, twist_r_side);
-          twist_rhand(Color::Y, twist_r_side);
-          twist_rhand(Color::Y, twist_r_side);
-          twist_rhand(Color::Y, twist_r_side);
-          twist_lhand(Color::Y, twist_l_side);
-          twist_lhand(Color::Y, twist_l_side);
-          twist_lhand(Color::Y, twist_l_side);
-          twist_lhand(Color::Y, twist_l_side);
-          twist_lhand(Color::Y, twist_l_side);
-        }
-        break;
-      }
+  optimize_moves(container);  // 마주 보는 두 축의 순서만 바뀌므로 다시 번호가 작은 축부터 둡니다.
+  return true;
+}
+uint8_t solve_color_neutral(uint8_t frames) {
+  const CubeState start = cube;
+  uint8_t best = 0, last = 0;
+  uint16_t best_length = 0xFFFF;
+  for (uint8_t frame = 0; frame < frames; ++frame) {
+    cube = start;
+    bool mapped = solve_in_frame(frame);
+    last = frame;
+    if (mapped && !container.overflowed() && container.length() < best_length) {
+      best_length = container.length();
+      best = frame;
     }
   }
+  if (last != best) {
+    cube = start;
+    solve_in_frame(best);
+  }
+  return best;
+}
 
-  // 8. 중복 회전 정리(WWWW >> void, WWW >> w)
-  for (uint16_t i = 0; i < container.length() - 3; ++i) {
-    if (container[i] == container[i + 1] && container[i] == container[i + 2] && container[i] == container[i + 3]) {
-      container[i + 0] = ' ';
-      container[i + 1] = ' ';
-      container[i + 2] = ' ';
-      container[i + 3] = ' ';
-    }
-  }
-  for (uint16_t i = 0; i < container.length() - 2; ++i) {
-    if (container[i] == container[i + 1] && container[i] == container[i + 2]) {
-      switch (container[i]) {
-        case 'W':
-          container[i] = 'w';
-          container[i + 1] = ' ';
-          container[i + 2] = ' ';
-          break;
-        case 'Y':
-          container[i] = 'y';
-          container[i + 1] = ' ';
-          container[i + 2] = ' ';
-          break;
-        case 'G':
-          container[i] = 'g';
-          container[i + 1] = ' ';
-          container[i + 2] = ' ';
-          break;
-        case 'B':
-          container[i] = 'b';
-          container[i + 1] = ' ';
-          container[i + 2] = ' ';
-          break;
-        case 'O':
-          container[i] = 'o';
-          container[i + 1] = ' ';
-          container[i + 2] = ' ';
-          break;
-        case 'R':
-          container[i] = 'r';
-          container[i + 1] = ' ';
-          container[i + 2] = ' ';
-          break;
+/* 되돌리기 해법
+ *
+ * 사람이 돌린 회전을 history_record()로 최대 HISTORY_CAPACITY개까지 모아 둡니다.
+ * optimize_moves()와 같은 규칙으로 기록할 때마다 맨 위(또는 그 아래의 마주 보는 축)와 합치므로, 앞뒤로 흔든 회전은 남지 않습니다.
+ * 맞춰진 상태부터 기록했다면 기록을 거꾸로, 반대 방향으로 돌리기만 해도 풀리므로 짧게 섞은 큐브는 solve()보다 훨씬 짧게 풉니다.
+ *
+ * history_shortcut()은 해법을 구한 뒤에 부르며, 되돌리기가 container의 해법보다 짧으면 container를 되돌리기로 바꿉니다.
+ * 기록이 넘쳤거나 맞춰진 상태부터의 기록이 아니면(history_valid가 false) 그대로 둡니다.
+ * 되돌리기는 해법을 구하기 전 상태(start)의 복사본에 먼저 적용해 보고, 실제로 풀리는 경우에만 씁니다.
+ */
+#ifndef HISTORY_CAPACITY
+#define HISTORY_CAPACITY 40
+#endif
+CUBE_THREAD_LOCAL uint8_t history[HISTORY_CAPACITY];  // 정리된 회전을 (axis * 4 + count)로 저장합니다.
+CUBE_THREAD_LOCAL uint8_t history_length = 0;
+CUBE_THREAD_LOCAL bool history_valid = true;
 
-        case 'w':
-          container[i] = 'W';
-          container[i + 1] = ' ';
-          container[i + 2] = ' ';
-          break;
-        case 'y':
-          container[i] = 'Y';
-          container[i + 1] = ' ';
-          container[i + 2] = ' ';
-          break;
-        case 'g':
-          container[i] = 'G';
-          container[i + 1] = ' ';
-          container[i + 2] = ' ';
-          break;
-        case 'b':
-          container[i] = 'B';
-          container[i + 1] = ' ';
-          container[i + 2] = ' ';
-          break;
-        case 'o':
-          container[i] = 'O';
-          container[i + 1] = ' ';
-          container[i + 2] = ' ';
-          break;
-        case 'r':
-          container[i] = 'R';
-          container[i + 1] = ' ';
-          container[i + 2] = ' ';
-          break;
-      }
+// 큐브가 맞춰진 상태일 때 불러서 기록을 새로 시작합니다.
+inline void history_reset() {
+  history_length = 0;
+  history_valid = true;
+}
+inline void history_record(uint8_t axis, uint8_t count) {
+  count %= 4;
+  if (!history_valid || count == 0) {
+    return;
+  }
+  uint8_t target = history_length;
+  if (history_length >= 1 && history[history_length - 1] / 4 == axis) {
+    target = history_length - 1;
+  } else if (history_length >= 2 && history[history_length - 1] / 4 / 2 == axis / 2
+             && history[history_length - 2] / 4 == axis) {
+    target = history_length - 2;
+  }
+  if (target < history_length) {
+    count = (count + history[target] % 4) % 4;
+    if (count != 0) {
+      history[target] = axis * 4 + count;
+    } else {
+      history[target] = history[history_length - 1];
+      history_length--;
     }
+    return;
+  }
+  if (history_length >= HISTORY_CAPACITY) {
+    history_valid = false;
+    return;
+  }
+  history[history_length++] = axis * 4 + count;
+}
+inline bool history_shortcut(const CubeState& start) {
+  if (!history_valid || history_length >= container.length()) {
+    return false;
+  }
+  CubeState check = start;
+  for (uint8_t i = history_length; i > 0; --i) {
+    turn_cube_move(check, history[i - 1] / 4 * 3 + (4 - history[i - 1] % 4) - 1);
+  }
+  if (!check.solved()) {
+    return false;
+  }
+  container.clear();
+  for (uint8_t i = history_length; i > 0; --i) {
+    append_move(container, history[i - 1] / 4 * 3 + (4 - history[i - 1] % 4) - 1);
   }
+  optimize_moves(container);  // 마주 보는 두 축을 번호가 작은 축부터 두어 동시에 돌릴 수 있게 합니다.
+  return true;
 }
 
 #endif // !VIRTUAL_CUBE_H
\ No newline at end of file
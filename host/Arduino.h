@@ -0,0 +1,257 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+/* 호스트(리눅스) 빌드용 Arduino 대체 헤더입니다.
+ *
+ * VirtualCube.h와 PhysicalCube.h는 스케치 안에서만 컴파일되도록 작성되어 있어서
+ * Arduino.h가 제공하는 타입과 함수(String, millis() 등)를 그대로 사용합니다.
+ * 호스트에서 벤치마크와 도구를 빌드할 수 있도록 그중 필요한 부분만 흉내 냅니다.
+ * 핀 입출력은 실제 하드웨어가 없으므로 핀 번호별 값을 저장하는 배열로 대신합니다.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <thread>
+
+// 1. 핀 입출력
+constexpr uint8_t LOW = 0;
+constexpr uint8_t HIGH = 1;
+constexpr uint8_t INPUT = 0;
+constexpr uint8_t OUTPUT = 1;
+constexpr uint8_t A0 = 14;
+constexpr uint8_t A1 = 15;
+constexpr uint8_t A2 = 16;
+constexpr uint8_t A3 = 17;
+constexpr uint8_t A4 = 18;
+constexpr uint8_t A5 = 19;
+
+inline int host_pin_value[20] = {};  // 핀 번호를 인덱스로 마지막에 쓴(또는 시뮬레이션이 넣은) 값을 저장합니다.
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t pin) {
+  return host_pin_value[pin];
+}
+inline void digitalWrite(uint8_t pin, uint8_t value) {
+  host_pin_value[pin] = value;
+}
+inline void analogWrite(uint8_t pin, int value) {
+  host_pin_value[pin] = value;
+}
+
+// 2. 시간
+// 모터 시뮬레이션처럼 시간을 직접 진행시켜야 하는 도구는 host_manual_clock을 켜고 host_clock_us를 늘립니다.
+inline std::chrono::steady_clock::time_point host_start_time = std::chrono::steady_clock::now();
+inline bool host_manual_clock = false;
+inline uint64_t host_clock_us = 0;
+
+inline uint32_t micros() {
+  if (host_manual_clock) {
+    return static_cast<uint32_t>(host_clock_us);
+  }
+  return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                 std::chrono::steady_clock::now() - host_start_time)
+                                 .count());
+}
+inline uint32_t millis() {
+  if (host_manual_clock) {
+    return static_cast<uint32_t>(host_clock_us / 1000);
+  }
+  return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                 std::chrono::steady_clock::now() - host_start_time)
+                                 .count());
+}
+inline void delay(uint32_t ms) {
+  if (host_manual_clock) {
+    host_clock_us += ms * 1000ull;
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+// 3. 플래시 메모리(PROGMEM)
+// 호스트에는 별도의 플래시 주소 공간이 없으므로 일반 메모리를 그대로 읽습니다.
+#define PROGMEM
+#define pgm_read_byte(address) (*reinterpret_cast<const uint8_t*>(address))
+#define pgm_read_word(address) (*reinterpret_cast<const uint16_t*>(address))
+#define memcpy_P(destination, source, size) memcpy((destination), (source), (size))
+#define F(string) (string)
+
+/* 4. String
+ *
+ * Arduino의 String 중 큐브 코드가 사용하는 부분만 구현합니다.
+ * AVR에서 unsigned int는 16비트이므로 length()도 16비트 값을 반환하고,
+ * 범위를 벗어난 operator[]는 Arduino와 같이 더미 문자를 돌려줍니다.
+ */
+class String {
+public:
+  String() = default;
+  String(const char* str) {
+    *this = str;
+  }
+
+  String& operator=(const char* str) {
+    if (buf != nullptr && str == buf) {
+      return *this;
+    }
+    len = 0;
+    for (; str[len] != '\0'; ++len) {
+      reserve(len + 1);
+      buf[len] = str[len];
+    }
+    terminate();
+    return *this;
+  }
+  String& operator+=(char c) {
+    reserve(len + 1);
+    buf[len++] = c;
+    terminate();
+    return *this;
+  }
+
+  uint16_t length() const {
+    return static_cast<uint16_t>(len);
+  }
+  const char* c_str() const {
+    return buf != nullptr ? buf : "";
+  }
+  char& operator[](unsigned int index) {
+    static char dummy_writable_char;
+    if (index >= len) {
+      dummy_writable_char = 0;
+      return dummy_writable_char;
+    }
+    return buf[index];
+  }
+  char operator[](unsigned int index) const {
+    return index < len ? buf[index] : 0;
+  }
+
+  char* begin() {
+    return buf;
+  }
+  char* end() {
+    return buf + len;
+  }
+
+  String(const String& other) {
+    *this = other.c_str();
+  }
+  String& operator=(const String& other) {
+    return *this = other.c_str();
+  }
+  ~String() {
+    free(buf);
+  }
+
+private:
+  void reserve(size_t size) {
+    if (size + 1 > cap) {
+      cap = (size + 1) * 2;
+      buf = static_cast<char*>(realloc(buf, cap));
+    }
+  }
+  void terminate() {
+    reserve(len);
+    buf[len] = '\0';
+  }
+
+  char* buf = nullptr;
+  size_t len = 0;
+  size_t cap = 0;
+};
+
+/* 5. Serial
+ *
+ * Serial.attach()로 연결한 파일 디스크립터(pty나 시리얼 장치)로 주고받습니다.
+ * 연결하지 않으면 읽을 데이터가 없고 쓴 데이터는 버립니다. print()는 텔레메트리 출력에 쓰는 문자열과 정수만 지원합니다.
+ * Arduino와 같이 읽기는 기다리지 않고, 받은 바이트를 64바이트 버퍼에 모아 둡니다.
+ */
+class HardwareSerial {
+public:
+  void begin(unsigned long) {}
+  void attach(int fd) {
+    this->fd = fd;
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  }
+  int available() {
+    fill();
+    return static_cast<int>(tail - head);
+  }
+  int read() {
+    fill();
+    return head < tail ? buffer[head++] : -1;
+  }
+  int peek() {
+    fill();
+    return head < tail ? buffer[head] : -1;
+  }
+  size_t write(uint8_t value) {
+    return write(&value, 1);
+  }
+  size_t write(const uint8_t* data, size_t size) {
+    for (size_t written = 0; fd >= 0 && written < size;) {
+      ssize_t result = ::write(fd, data + written, size - written);
+      if (result > 0) {
+        written += result;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+    return size;
+  }
+  size_t print(const char* text) {
+    return write(reinterpret_cast<const uint8_t*>(text), strlen(text));
+  }
+  size_t print(char c) {
+    return write(static_cast<uint8_t>(c));
+  }
+  size_t print(unsigned long value) {
+    char text[24];
+    snprintf(text, sizeof(text), "%lu", value);
+    return print(text);
+  }
+  size_t print(long value) {
+    char text[24];
+    snprintf(text, sizeof(text), "%ld", value);
+    return print(text);
+  }
+  size_t print(unsigned int value) {
+    return print(static_cast<unsigned long>(value));
+  }
+  size_t print(int value) {
+    return print(static_cast<long>(value));
+  }
+  template <typename T>
+  size_t println(T value) {
+    return print(value) + print('\n');
+  }
+  size_t println() {
+    return print('\n');
+  }
+
+private:
+  void fill() {
+    if (fd < 0 || head < tail) {
+      return;
+    }
+    ssize_t result = ::read(fd, buffer, sizeof(buffer));
+    head = 0;
+    tail = result > 0 ? result : 0;
+  }
+
+  int fd = -1;
+  uint8_t buffer[64];
+  size_t head = 0;
+  size_t tail = 0;
+};
+inline HardwareSerial Serial;
+
+#endif  // !HOST_ARDUINO_H
@@ -0,0 +1,205 @@
+#ifndef HOST_BATCH_CUBE_H
+#define HOST_BATCH_CUBE_H
+
+#include <string.h>
+
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BATCH_CUBE_X86 1
+#else
+#define BATCH_CUBE_X86 0
+#endif
+
+#include "VirtualCube.h"
+
+/* 상태 묶음 엔진
+ *
+ * 탐색처럼 많은 상태에 같은 회전을 적용하는 호스트 도구를 위한 구조체 배열(SoA) 엔진입니다.
+ * 상태 N개를 자리마다 한 줄(N바이트)씩, 코너 8줄과 엣지 12줄로 둡니다. 칸의 값은 CubeState와 같습니다
+ * (코너는 조각 번호 | 방향 << 3, 엣지는 조각 번호 | 방향 << 4).
+ *
+ * 회전 하나는 자리마다 "어느 자리의 줄을 가져와 방향을 얼마나 더하는지"입니다. 그래서 자리의 순열은 줄을 고르는 것으로 끝나고,
+ * 상태마다 하는 일은 코너 방향 더하기(24 이상이면 24를 뺌)와 엣지 방향 뒤집기뿐입니다. 이것을 상태 16개(SSE2) 또는 32개(AVX2)씩 한 번에 합니다.
+ * 바뀌지 않는 줄은 그대로 복사합니다. 표는 맞춰진 CubeState에 turn_cube_move()를 적용해서 만들므로(자리마다 그 자리로 올 조각이 있던 자리와 더할 방향)
+ * rotate()와 같은 회전 모델입니다. host/bench_batch.cpp가 rotate()와 결과를 비교하고 초당 상태-회전 수를 잽니다.
+ *
+ * batch_apply()는 in의 모든 상태에 회전 하나를 적용해서 out에 씁니다(out은 in과 같은 크기여야 하며 같은 묶음이면 안 됩니다).
+ * 커널은 실행하는 CPU에 맞춰 batch_cube_kernel에 골라 둡니다. AVX2가 있으면 AVX2, x86이면 SSE2, 그 밖은 스칼라입니다.
+ * 빌드 옵션(-march)은 그대로 두고 AVX2 커널만 target 속성으로 따로 컴파일합니다.
+ */
+enum class BatchKernel : uint8_t {
+  SCALAR,
+  SSE2,
+  AVX2,
+};
+const char* const batch_kernel_names[3] = { "scalar", "sse2", "avx2" };
+constexpr size_t BATCH_CUBE_ALIGN = 32;  // 줄의 길이를 이만큼의 배수로 맞춰서 커널에 남는 상태가 없게 합니다.
+
+struct BatchMove {
+  uint8_t corner_source[8];
+  uint8_t corner_add[8];  // 방향 << 3
+  uint8_t edge_source[12];
+  uint8_t edge_flip[12];  // 방향 << 4
+};
+inline const BatchMove* batch_moves() {
+  static const std::vector<BatchMove> table = [] {
+    std::vector<BatchMove> moves(MOVE_COUNT);
+    for (uint8_t move = 0; move < MOVE_COUNT; ++move) {
+      CubeState turned;
+      turn_cube_move(turned, move);
+      for (uint8_t pos = 0; pos < 8; ++pos) {
+        moves[move].corner_source[pos] = turned.corner_pos(pos);
+        moves[move].corner_add[pos] = turned.corner_ori(pos) << 3;
+      }
+      for (uint8_t pos = 0; pos < 12; ++pos) {
+        moves[move].edge_source[pos] = turned.edge_pos(pos);
+        moves[move].edge_flip[pos] = turned.edge_ori(pos) << 4;
+      }
+    }
+    return moves;
+  }();
+  return table.data();
+}
+
+struct BatchCube {
+  size_t count;
+  size_t stride;  // 한 줄의 길이(count를 BATCH_CUBE_ALIGN의 배수로 올림). 남는 칸은 맞춰진 상태입니다.
+  std::vector<uint8_t> data;
+
+  explicit BatchCube(size_t count)
+      : count(count), stride((count + BATCH_CUBE_ALIGN - 1) / BATCH_CUBE_ALIGN * BATCH_CUBE_ALIGN), data(20 * stride) {
+    for (uint8_t pos = 0; pos < 8; ++pos) {
+      memset(corner_row(pos), pos, stride);
+    }
+    for (uint8_t pos = 0; pos < 12; ++pos) {
+      memset(edge_row(pos), pos, stride);
+    }
+  }
+  uint8_t* corner_row(uint8_t pos) {
+    return data.data() + pos * stride;
+  }
+  const uint8_t* corner_row(uint8_t pos) const {
+    return data.data() + pos * stride;
+  }
+  uint8_t* edge_row(uint8_t pos) {
+    return data.data() + (8 + pos) * stride;
+  }
+  const uint8_t* edge_row(uint8_t pos) const {
+    return data.data() + (8 + pos) * stride;
+  }
+
+  void set(size_t index, const CubeState& state) {
+    for (uint8_t pos = 0; pos < 8; ++pos) {
+      corner_row(pos)[index] = state.corners[pos];
+    }
+    for (uint8_t pos = 0; pos < 12; ++pos) {
+      edge_row(pos)[index] = state.edges[pos];
+    }
+  }
+  CubeState get(size_t index) const {
+    CubeState state;
+    for (uint8_t pos = 0; pos < 8; ++pos) {
+      state.corners[pos] = corner_row(pos)[index];
+    }
+    for (uint8_t pos = 0; pos < 12; ++pos) {
+      state.edges[pos] = edge_row(pos)[index];
+    }
+    return state;
+  }
+};
+
+inline void batch_corner_row_scalar(const uint8_t* in, uint8_t* out, size_t size, uint8_t add) {
+  for (size_t i = 0; i < size; ++i) {
+    uint8_t field = in[i] + add;
+    out[i] = field >= 24 ? field - 24 : field;
+  }
+}
+inline void batch_edge_row_scalar(const uint8_t* in, uint8_t* out, size_t size, uint8_t flip) {
+  for (size_t i = 0; i < size; ++i) {
+    out[i] = in[i] ^ flip;
+  }
+}
+#if BATCH_CUBE_X86
+// 24를 뺀 값과 부호 없는 최솟값을 고릅니다. 24보다 작으면 뺀 값이 232 이상으로 넘어가므로 원래 값이 남습니다.
+inline void batch_corner_row_sse2(const uint8_t* in, uint8_t* out, size_t size, uint8_t add) {
+  const __m128i added = _mm_set1_epi8(add), wrap = _mm_set1_epi8(24);
+  for (size_t i = 0; i < size; i += 16) {
+    __m128i field = _mm_add_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)), added);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_min_epu8(field, _mm_sub_epi8(field, wrap)));
+  }
+}
+inline void batch_edge_row_sse2(const uint8_t* in, uint8_t* out, size_t size, uint8_t flip) {
+  const __m128i flipped = _mm_set1_epi8(flip);
+  for (size_t i = 0; i < size; i += 16) {
+    __m128i field = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_xor_si128(field, flipped));
+  }
+}
+__attribute__((target("avx2"))) inline void batch_corner_row_avx2(const uint8_t* in, uint8_t* out, size_t size, uint8_t add) {
+  const __m256i added = _mm256_set1_epi8(add), wrap = _mm256_set1_epi8(24);
+  for (size_t i = 0; i < size; i += 32) {
+    __m256i field = _mm256_add_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i)), added);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_min_epu8(field, _mm256_sub_epi8(field, wrap)));
+  }
+}
+__attribute__((target("avx2"))) inline void batch_edge_row_avx2(const uint8_t* in, uint8_t* out, size_t size, uint8_t flip) {
+  const __m256i flipped = _mm256_set1_epi8(flip);
+  for (size_t i = 0; i < size; i += 32) {
+    __m256i field = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_xor_si256(field, flipped));
+  }
+}
+#endif
+
+// 이 CPU에서 쓸 수 있는 커널인지 확인합니다.
+inline bool batch_kernel_supported(BatchKernel kernel) {
+#if BATCH_CUBE_X86
+  return kernel != BatchKernel::AVX2 || __builtin_cpu_supports("avx2");
+#else
+  return kernel == BatchKernel::SCALAR;
+#endif
+}
+inline BatchKernel batch_best_kernel() {
+  return batch_kernel_supported(BatchKernel::AVX2) ? BatchKernel::AVX2
+         : batch_kernel_supported(BatchKernel::SSE2) ? BatchKernel::SSE2
+                                                      : BatchKernel::SCALAR;
+}
+inline BatchKernel batch_cube_kernel = batch_best_kernel();
+
+inline void batch_apply(const BatchCube& in, uint8_t move, BatchCube& out, BatchKernel kernel = batch_cube_kernel) {
+  const BatchMove& table = batch_moves()[move];
+  for (uint8_t pos = 0; pos < 8; ++pos) {
+    const uint8_t* source = in.corner_row(table.corner_source[pos]);
+    uint8_t* target = out.corner_row(pos);
+    if (table.corner_add[pos] == 0) {
+      memcpy(target, source, in.stride);
+      continue;
+    }
+    switch (kernel) {
+#if BATCH_CUBE_X86
+      case BatchKernel::AVX2: batch_corner_row_avx2(source, target, in.stride, table.corner_add[pos]); break;
+      case BatchKernel::SSE2: batch_corner_row_sse2(source, target, in.stride, table.corner_add[pos]); break;
+#endif
+      default: batch_corner_row_scalar(source, target, in.stride, table.corner_add[pos]); break;
+    }
+  }
+  for (uint8_t pos = 0; pos < 12; ++pos) {
+    const uint8_t* source = in.edge_row(table.edge_source[pos]);
+    uint8_t* target = out.edge_row(pos);
+    if (table.edge_flip[pos] == 0) {
+      memcpy(target, source, in.stride);
+      continue;
+    }
+    switch (kernel) {
+#if BATCH_CUBE_X86
+      case BatchKernel::AVX2: batch_edge_row_avx2(source, target, in.stride, table.edge_flip[pos]); break;
+      case BatchKernel::SSE2: batch_edge_row_sse2(source, target, in.stride, table.edge_flip[pos]); break;
+#endif
+      default: batch_edge_row_scalar(source, target, in.stride, table.edge_flip[pos]); break;
+    }
+  }
+}
+
+#endif  // !HOST_BATCH_CUBE_H
@@ -0,0 +1,59 @@
+#ifndef HOST_COLOR_NEUTRAL_H
+#define HOST_COLOR_NEUTRAL_H
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "VirtualCube.h"
+
+/* 여러 스레드 색 중립 해법
+ *
+ * VirtualCube.h의 solve_color_neutral()과 같은 해법(면 회전이 가장 적고, 같으면 대칭 번호가 작은 쪽)을 시점들을 스레드에 나눠 구합니다.
+ * 스레드 t는 대칭 t, t + threads, ...를 풀어 자기 몫에서 가장 짧은 해법을 남기고, 부른 스레드가 그중 가장 짧은 것을 container에 옮깁니다.
+ * 스레드마다 cube와 container를 따로 써야 하므로 CUBE_THREAD_LOCAL을 thread_local로 정의한 도구에서만 부르세요.
+ * 상태 하나의 응답 시간이 중요한 offload_server가 씁니다. 여러 상태를 함께 푸는 batch_solve는 항목 단위로 이미 나눠 풀므로 solve_color_neutral()을 씁니다.
+ */
+inline uint8_t color_neutral_solve(uint8_t frames, uint8_t threads) {
+  struct Best {
+    uint16_t length = 0xFFFF;
+    uint8_t frame = 0;
+    MoveBuffer solution;
+  };
+  const CubeState start = cube;
+  threads = std::max<uint8_t>(1, std::min(threads, frames));
+  std::vector<Best> best(threads);
+  std::vector<std::thread> workers;
+  for (uint8_t self = 0; self < threads; ++self) {
+    workers.emplace_back([&, self] {
+      for (uint8_t frame = self; frame < frames; frame += threads) {
+        cube = start;
+        bool mapped = solve_in_frame(frame);
+        if (mapped && !container.overflowed() && container.length() < best[self].length) {
+          best[self].length = container.length();
+          best[self].frame = frame;
+          best[self].solution = container;
+        }
+      }
+    });
+  }
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+
+  const Best* chosen = &best[0];
+  for (const Best& other : best) {
+    if (other.length < chosen->length || (other.length == chosen->length && other.frame < chosen->frame)) {
+      chosen = &other;
+    }
+  }
+  if (chosen->length == 0xFFFF) {  // 모든 해법이 버퍼를 넘쳤으면 이 스레드에서 그대로 풉니다.
+    cube = start;
+    return solve_color_neutral(1);
+  }
+  container = chosen->solution;
+  cube = CubeState();  // 다른 스레드에서 푼 해법이므로 이 스레드의 cube도 맞춰진 상태로 둡니다.
+  return chosen->frame;
+}
+
+#endif  // !HOST_COLOR_NEUTRAL_H
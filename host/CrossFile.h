@@ -0,0 +1,28 @@
+#ifndef HOST_CROSS_FILE_H
+#define HOST_CROSS_FILE_H
+
+#include <stdio.h>
+
+#include "VirtualCube.h"
+
+/* 흰 십자가 표 파일
+ *
+ * host/cross_gen.cpp가 쓴 파일(CROSS_TABLE_SIZE바이트, 머리말 없음)을 읽어 VirtualCube.h의 cross_table에 연결합니다.
+ * 표는 읽기만 하므로 여러 스레드의 solve()가 함께 씁니다. 스레드를 시작하기 전에 한 번 부르세요.
+ */
+inline bool cross_table_load(const char* path) {
+  static uint8_t storage[CROSS_TABLE_SIZE];
+  FILE* file = fopen(path, "rb");
+  if (file == nullptr) {
+    return false;
+  }
+  bool complete = fread(storage, 1, sizeof(storage), file) == sizeof(storage) && fgetc(file) == EOF;
+  fclose(file);
+  if (!complete || (storage[0] & 15) != 0) {  // 맞춰진 십자가(번호 0)의 거리는 0입니다.
+    return false;
+  }
+  cross_table = storage;
+  return true;
+}
+
+#endif  // !HOST_CROSS_FILE_H
@@ -0,0 +1,376 @@
+#ifndef HOST_OPTIMAL_H
+#define HOST_OPTIMAL_H
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "VirtualCube.h"
+
+/* 최적 해법(Korf IDA*)
+ *
+ * 오프라인 분석과 시연용 스크램블의 해법을 미리 구하기 위한 호스트 전용 해법입니다.
+ * 180도 회전을 1회로 세는 회전 수(HTM)가 가장 적은 해법을 IDA*로 찾습니다.
+ *
+ * 하한은 세 패턴 데이터베이스(PDB)의 가장 큰 값입니다.
+ *   corners.pdb    코너 8개의 자리와 방향                 88,179,840가지
+ *   edges_0_5.pdb  엣지 0~5의 자리와 방향(나머지는 무시)  42,577,920가지
+ *   edges_6_11.pdb 엣지 6~11의 자리와 방향               42,577,920가지
+ * 값은 맞춰진 상태까지의 최소 회전 수를 4비트씩 저장하며, 합쳐 약 87MB입니다.
+ *
+ * PDB는 host/optimal_gen.cpp가 한 번 만들어 두고, optimal_init()은 파일을 mmap으로 읽기 전용 공유 매핑만 합니다.
+ * 그래서 시작이 밀리초 단위로 끝나고, 여러 프로세스가 같은 페이지 캐시를 나눠 씁니다.
+ *
+ * 탐색은 VirtualCube의 회전 모델(turn_cubies_move())에서 만든 조각 기준 회전표 위에서 이뤄집니다.
+ */
+
+constexpr uint32_t PDB_CORNER_COUNT = 40320u * 2187;         // 8! * 3^7
+constexpr uint32_t PDB_EDGE_PERM_COUNT = 12 * 11 * 10 * 9 * 8 * 7;
+constexpr uint32_t PDB_EDGE_COUNT = PDB_EDGE_PERM_COUNT * 64;  // 12P6 * 2^6
+constexpr uint8_t PDB_EDGE_GROUP_SIZE = 6;
+constexpr uint8_t PDB_UNKNOWN = 15;
+constexpr uint8_t OPTIMAL_DEPTH_LIMIT = 26;
+
+constexpr uint8_t PATTERN_CORNERS = 0;
+constexpr uint8_t PATTERN_EDGES_LOW = 1;
+constexpr uint8_t PATTERN_EDGES_HIGH = 2;
+constexpr uint8_t PATTERN_COUNT = 3;
+const char* const pattern_file_names[PATTERN_COUNT] = { "corners.pdb", "edges_0_5.pdb", "edges_6_11.pdb" };
+
+// PDB 파일의 앞부분입니다. 뒤에 (entry_count + 1) / 2 바이트의 값이 이어집니다(짝수 번호가 아래 4비트).
+struct PatternFileHeader {
+  char magic[8];  // "RCPDB01"
+  uint32_t kind;
+  uint32_t entry_count;
+};
+constexpr char PATTERN_FILE_MAGIC[8] = "RCPDB01";
+
+inline uint32_t pattern_entry_count(uint8_t kind) {
+  return kind == PATTERN_CORNERS ? PDB_CORNER_COUNT : PDB_EDGE_COUNT;
+}
+
+/* 1. 조각 기준 상태
+ *
+ * corner_pos/edge_pos는 자리 -> 조각이지만, PDB 번호는 조각 -> 자리로 계산하는 편이 간단해서
+ * 탐색 중에는 조각 번호를 인덱스로 자리와 방향을 저장합니다.
+ */
+struct PieceState {
+  uint8_t corner_pos[8];
+  uint8_t corner_ori[8];
+  uint8_t edge_pos[12];
+  uint8_t edge_ori[12];
+};
+
+// 회전마다, 각 자리에 있던 조각이 옮겨 가는 자리와 더해지는 방향입니다.
+struct PieceMove {
+  uint8_t corner_target[8];
+  uint8_t corner_twist[8];
+  uint8_t edge_target[12];
+  uint8_t edge_flip[12];
+};
+PieceMove piece_moves[MOVE_COUNT];
+
+// 맞춰진 상태에 turn_cubies_move()를 적용한 결과에서 조각 기준 회전표를 만듭니다.
+inline void piece_moves_init() {
+  static bool ready = false;
+  if (ready) {
+    return;
+  }
+  for (uint8_t move = 0; move < MOVE_COUNT; ++move) {
+    uint8_t c_pos[8], c_ori[8] = {}, e_pos[12], e_ori[12] = {};
+    for (uint8_t i = 0; i < 8; ++i) {
+      c_pos[i] = i;
+    }
+    for (uint8_t i = 0; i < 12; ++i) {
+      e_pos[i] = i;
+    }
+    turn_cubies_move(c_pos, c_ori, e_pos, e_ori, move);
+    PieceMove& piece_move = piece_moves[move];
+    for (uint8_t pos = 0; pos < 8; ++pos) {
+      piece_move.corner_target[c_pos[pos]] = pos;
+      piece_move.corner_twist[c_pos[pos]] = c_ori[pos];
+    }
+    for (uint8_t pos = 0; pos < 12; ++pos) {
+      piece_move.edge_target[e_pos[pos]] = pos;
+      piece_move.edge_flip[e_pos[pos]] = e_ori[pos];
+    }
+  }
+  ready = true;
+}
+
+inline PieceState piece_state_from_cube() {
+  PieceState state;
+  for (uint8_t pos = 0; pos < 8; ++pos) {
+    state.corner_pos[cube.corner_pos(pos)] = pos;
+    state.corner_ori[cube.corner_pos(pos)] = cube.corner_ori(pos);
+  }
+  for (uint8_t pos = 0; pos < 12; ++pos) {
+    state.edge_pos[cube.edge_pos(pos)] = pos;
+    state.edge_ori[cube.edge_pos(pos)] = cube.edge_ori(pos);
+  }
+  return state;
+}
+inline PieceState piece_state_solved() {
+  PieceState state = {};
+  for (uint8_t i = 0; i < 8; ++i) {
+    state.corner_pos[i] = i;
+  }
+  for (uint8_t i = 0; i < 12; ++i) {
+    state.edge_pos[i] = i;
+  }
+  return state;
+}
+
+inline void piece_state_apply(PieceState& state, uint8_t move) {
+  const PieceMove& piece_move = piece_moves[move];
+  for (uint8_t piece = 0; piece < 8; ++piece) {
+    uint8_t pos = state.corner_pos[piece];
+    state.corner_ori[piece] = (state.corner_ori[piece] + piece_move.corner_twist[pos]) % 3;
+    state.corner_pos[piece] = piece_move.corner_target[pos];
+  }
+  for (uint8_t piece = 0; piece < 12; ++piece) {
+    uint8_t pos = state.edge_pos[piece];
+    state.edge_ori[piece] ^= piece_move.edge_flip[pos];
+    state.edge_pos[piece] = piece_move.edge_target[pos];
+  }
+}
+
+/* 2. PDB 번호
+ *
+ * 코너: 자리의 순열 번호(Lehmer, 0..40319) * 2187 + 코너 0~6의 방향(3진수). 코너 7의 방향은 합으로 정해집니다.
+ * 엣지: 조각 first..first+5의 자리를 고르는 순열 번호(12P6, 0..665279) * 64 + 여섯 조각의 방향(2진수).
+ */
+inline uint32_t corner_pattern_index(const PieceState& state) {
+  uint32_t perm = 0;
+  for (uint8_t i = 0; i < 8; ++i) {
+    uint8_t smaller = 0;
+    for (uint8_t j = i + 1; j < 8; ++j) {
+      smaller += state.corner_pos[j] < state.corner_pos[i];
+    }
+    perm = perm * (8 - i) + smaller;
+  }
+  uint32_t twist = 0;
+  for (uint8_t i = 0; i < 7; ++i) {
+    twist = twist * 3 + state.corner_ori[i];
+  }
+  return perm * 2187 + twist;
+}
+inline void corner_pattern_decode(uint32_t index, PieceState& state) {
+  uint32_t twist = index % 2187;
+  uint32_t perm = index / 2187;
+  uint8_t sum = 0;
+  for (int i = 6; i >= 0; --i) {
+    state.corner_ori[i] = twist % 3;
+    sum += state.corner_ori[i];
+    twist /= 3;
+  }
+  state.corner_ori[7] = (3 - sum % 3) % 3;
+  uint8_t digits[8];
+  for (int i = 7; i >= 0; --i) {
+    digits[i] = perm % (8 - i);
+    perm /= 8 - i;
+  }
+  // digits[i]는 아직 쓰지 않은 자리 중 조각 i의 자리의 순위입니다.
+  uint8_t used = 0;
+  for (uint8_t i = 0; i < 8; ++i) {
+    uint8_t rank = digits[i];
+    for (uint8_t pos = 0; pos < 8; ++pos) {
+      if (!(used >> pos & 1) && rank-- == 0) {
+        state.corner_pos[i] = pos;
+        used |= 1 << pos;
+        break;
+      }
+    }
+  }
+}
+
+inline uint32_t edge_pattern_index(const PieceState& state, uint8_t first) {
+  uint16_t used = 0;
+  uint32_t perm = 0;
+  uint32_t flip = 0;
+  for (uint8_t i = 0; i < PDB_EDGE_GROUP_SIZE; ++i) {
+    uint8_t pos = state.edge_pos[first + i];
+    uint8_t rank = pos - __builtin_popcount(used & ((1u << pos) - 1));
+    perm = perm * (12 - i) + rank;
+    used |= 1 << pos;
+    flip = flip * 2 + state.edge_ori[first + i];
+  }
+  return perm * 64 + flip;
+}
+// 조각 first..first+5만 채웁니다. 나머지 엣지는 0번 자리에 두며 PDB 생성에는 쓰이지 않습니다.
+inline void edge_pattern_decode(uint32_t index, PieceState& state, uint8_t first) {
+  uint32_t flip = index % 64;
+  uint32_t perm = index / 64;
+  uint8_t digits[PDB_EDGE_GROUP_SIZE];
+  for (int i = PDB_EDGE_GROUP_SIZE - 1; i >= 0; --i) {
+    digits[i] = perm % (12 - i);
+    perm /= 12 - i;
+    state.edge_ori[first + i] = flip & 1;
+    flip >>= 1;
+  }
+  memset(state.edge_pos + (first == 0 ? PDB_EDGE_GROUP_SIZE : 0), 0, 12 - PDB_EDGE_GROUP_SIZE);
+  memset(state.edge_ori + (first == 0 ? PDB_EDGE_GROUP_SIZE : 0), 0, 12 - PDB_EDGE_GROUP_SIZE);
+  uint16_t used = 0;
+  for (uint8_t i = 0; i < PDB_EDGE_GROUP_SIZE; ++i) {
+    uint8_t rank = digits[i];
+    for (uint8_t pos = 0; pos < 12; ++pos) {
+      if (!(used >> pos & 1) && rank-- == 0) {
+        state.edge_pos[first + i] = pos;
+        used |= 1 << pos;
+        break;
+      }
+    }
+  }
+}
+
+inline uint32_t pattern_index(uint8_t kind, const PieceState& state) {
+  switch (kind) {
+    case PATTERN_CORNERS: return corner_pattern_index(state);
+    case PATTERN_EDGES_LOW: return edge_pattern_index(state, 0);
+    default: return edge_pattern_index(state, PDB_EDGE_GROUP_SIZE);
+  }
+}
+inline void pattern_decode(uint8_t kind, uint32_t index, PieceState& state) {
+  switch (kind) {
+    case PATTERN_CORNERS: corner_pattern_decode(index, state); break;
+    case PATTERN_EDGES_LOW: edge_pattern_decode(index, state, 0); break;
+    default: edge_pattern_decode(index, state, PDB_EDGE_GROUP_SIZE); break;
+  }
+}
+
+/* 3. PDB 파일 */
+struct PatternDatabase {
+  const uint8_t* entries = nullptr;
+  uint32_t entry_count = 0;
+  void* mapping = nullptr;
+  size_t mapping_size = 0;
+};
+PatternDatabase pattern_databases[PATTERN_COUNT];
+
+inline uint8_t pattern_distance(const PatternDatabase& database, uint32_t index) {
+  return database.entries[index / 2] >> (index % 2 * 4) & 15;
+}
+
+// 파일 하나를 읽기 전용 공유 매핑으로 엽니다. 크기나 머리말이 맞지 않으면 false를 반환합니다.
+inline bool pattern_map(PatternDatabase& database, const char* path, uint8_t kind) {
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat info;
+  uint32_t entry_count = pattern_entry_count(kind);
+  size_t expected_size = sizeof(PatternFileHeader) + (entry_count + 1) / 2;
+  if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) != expected_size) {
+    close(fd);
+    return false;
+  }
+  void* mapping = mmap(nullptr, expected_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    return false;
+  }
+  const PatternFileHeader* header = static_cast<const PatternFileHeader*>(mapping);
+  if (memcmp(header->magic, PATTERN_FILE_MAGIC, sizeof(header->magic)) != 0 || header->kind != kind
+      || header->entry_count != entry_count) {
+    munmap(mapping, expected_size);
+    return false;
+  }
+  madvise(mapping, expected_size, MADV_RANDOM);
+  database.mapping = mapping;
+  database.mapping_size = expected_size;
+  database.entries = static_cast<const uint8_t*>(mapping) + sizeof(PatternFileHeader);
+  database.entry_count = entry_count;
+  return true;
+}
+
+// directory 안의 PDB 세 개를 엽니다. 하나라도 없거나 잘못되었으면 false를 반환합니다.
+inline bool optimal_init(const char* directory) {
+  piece_moves_init();
+  for (uint8_t kind = 0; kind < PATTERN_COUNT; ++kind) {
+    if (pattern_databases[kind].entries != nullptr) {
+      continue;
+    }
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s", directory, pattern_file_names[kind]);
+    if (!pattern_map(pattern_databases[kind], path, kind)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* 4. 탐색 */
+uint64_t optimal_node_count;  // 마지막 optimal_solve()가 방문한 노드 수입니다.
+
+inline uint8_t optimal_heuristic(const PieceState& state) {
+  uint8_t bound = 0;
+  for (uint8_t kind = 0; kind < PATTERN_COUNT; ++kind) {
+    uint8_t distance = pattern_distance(pattern_databases[kind], pattern_index(kind, state));
+    bound = distance > bound ? distance : bound;
+  }
+  return bound;
+}
+// 하한이 remaining을 넘는지 확인합니다. 넘는 PDB를 찾는 즉시 나머지는 읽지 않습니다.
+inline bool optimal_prune(const PieceState& state, uint8_t remaining) {
+  for (uint8_t kind = 0; kind < PATTERN_COUNT; ++kind) {
+    if (pattern_distance(pattern_databases[kind], pattern_index(kind, state)) > remaining) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// remaining 회전 안에 맞출 수 있으면 moves[depth..]에 회전을 채우고 true를 반환합니다.
+inline bool optimal_search(const PieceState& state, uint8_t depth, uint8_t remaining, uint8_t moves[]) {
+  optimal_node_count++;
+  if (remaining == 0) {
+    return optimal_heuristic(state) == 0;  // 세 PDB가 모두 0이면 모든 조각이 제자리입니다.
+  }
+  for (uint8_t move = 0; move < MOVE_COUNT; ++move) {
+    if (skip_move(moves, depth, move)) {
+      continue;
+    }
+    PieceState next = state;
+    piece_state_apply(next, move);
+    if (optimal_prune(next, remaining - 1)) {
+      continue;
+    }
+    moves[depth] = move;
+    if (optimal_search(next, depth + 1, remaining - 1, moves)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/* 5. 해법 구하기
+ *
+ * 전역 상태의 최적 해법을 container에 저장하고 전역 상태를 맞춰진 상태로 만든 뒤 회전 수를 반환합니다.
+ * optimal_init()이 성공하기 전이거나 max_length 이하의 해법이 없으면 상태를 그대로 두고 -1을 반환합니다.
+ */
+inline int optimal_solve(uint8_t max_length = 20) {
+  optimal_node_count = 0;
+  for (const PatternDatabase& database : pattern_databases) {
+    if (database.entries == nullptr) {
+      return -1;
+    }
+  }
+  PieceState state = piece_state_from_cube();
+  uint8_t moves[OPTIMAL_DEPTH_LIMIT];
+  for (uint8_t length = optimal_heuristic(state); length <= max_length && length < OPTIMAL_DEPTH_LIMIT; ++length) {
+    if (!optimal_search(state, 0, length, moves)) {
+      continue;
+    }
+    container.clear();
+    for (uint8_t i = 0; i < length; ++i) {
+      append_move(container, moves[i]);
+      turn_cube_move(cube, moves[i]);
+    }
+    return length;
+  }
+  return -1;
+}
+
+#endif  // !HOST_OPTIMAL_H
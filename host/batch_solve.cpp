@@ -0,0 +1,402 @@
+/* 여러 스레드 일괄 해법 도구
+ *
+ * 스크램블이나 상태를 파일에서 읽어 작업 훔치기(work stealing) 스레드 풀로 풀고,
+ * 항목마다 해법과 통계를 입력 순서대로 출력합니다.
+ * 해법 함수들은 전역 변수(cube, container, Thistlethwaite 탐색 상태)를 쓰므로
+ * CUBE_THREAD_LOCAL을 thread_local로 정의해서 스레드마다 따로 둡니다. TwoPhase.h의 표는 시작 전에 한 번 만들어 함께 읽습니다.
+ *
+ * 항목은 BATCH_CHUNK개씩 묶어 스레드마다 돌아가며 나눠 주고, 자기 몫을 앞에서부터 풀다가 다 풀면
+ * 다른 스레드의 몫을 뒤에서부터 훔쳐 옵니다. 출력은 메인 스레드가 묶음 순서대로 기다렸다가 씁니다.
+ *
+ * 입력
+ *   - 텍스트(기본): 한 줄에 스크램블 하나. 해법과 같은 알파벳(대문자 90도 시계, 소문자 90도 반시계, 축 번호 숫자 180도)이며 빈 줄은 건너뜁니다.
+ *   - 바이너리(--states): 상태 하나에 40바이트. Offload.h가 장치와 주고받는 상태와 같은 형식입니다.
+ *   - --random <개수> <길이> [시드=1]: 시드가 고정된 무작위 스크램블
+ * 입력 파일로 -를 주면 표준 입력에서 읽습니다. 입력은 모두 읽은 뒤에 풀기 시작합니다.
+ * --save-states를 주면 읽은 상태들을 바이너리 형식으로 저장합니다(풀 수 없는 입력은 빠집니다).
+ * --cross를 주면 cross_gen이 만든 흰 십자가 표를 읽어 solve()의 1단계를 최적으로 풉니다.
+ * --solver neutral은 solve_color_neutral()로 대칭 --frames개(기본 48, 24면 회전만)의 시점에서 풀어 가장 짧은 해법을 씁니다.
+ * 항목들을 이미 스레드에 나눠 풀므로 항목 하나의 시점들은 한 스레드에서 차례로 풉니다.
+ *
+ * 출력(표준 출력, 탭 구분): 번호, 결과(ok/fallback/invalid-input/invalid), 면 회전 수(180도를 1회로 셈), 해법 시간(us), 탐색 노드 수, 해법
+ * fallback은 two-phase/thistlethwaite가 예산 안에 풀지 못해 solve()로 대신한 경우입니다.
+ * 요약(표준 오류): 처리량, 해법 길이, 스레드별로 푼 묶음 수와 그중 훔친 묶음 수
+ *
+ * 사용법: batch_solve [--threads N] [--solver lbl|two-phase|thistlethwaite|neutral] [--frames N] [--cross <표 파일>] [--states]
+ *                     [--save-states <파일>] <입력 파일|->
+ *         batch_solve [옵션] --random <개수> <길이> [시드=1]
+ * --threads, --frames, --random의 개수와 길이는 1 이상의 10진수여야 합니다. 아니면 사용법을 출력하고 종료 코드 2로 끝납니다.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Arduino.h"
+
+#define CUBE_THREAD_LOCAL thread_local
+#include "CrossFile.h"
+#include "Offload.h"
+#include "Thistlethwaite.h"
+#include "TwoPhase.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t BATCH_CHUNK = 64;  // 스레드가 한 번에 가져가는 항목 수
+
+enum class Solver : uint8_t {
+  LBL,
+  TWO_PHASE,
+  THISTLETHWAITE,
+  NEUTRAL,
+};
+const char* const solver_names[4] = { "lbl", "two-phase", "thistlethwaite", "neutral" };
+
+struct Item {
+  CubeState state;
+  bool valid;
+};
+
+// 묶음 하나의 출력과 통계입니다. done이 켜진 뒤에만 메인 스레드가 읽습니다.
+struct Chunk {
+  std::string output;
+  uint32_t invalid_inputs = 0;
+  uint32_t invalid_solutions = 0;
+  uint32_t fallbacks = 0;
+  uint64_t face_turns = 0;
+  uint32_t max_face_turns = 0;
+  std::atomic<bool> done{ false };
+};
+
+struct WorkQueue {
+  std::mutex mutex;
+  std::deque<uint32_t> chunks;
+  uint32_t solved_chunks = 0;
+  uint32_t stolen_chunks = 0;
+};
+
+Item scramble_item(const std::string& scramble) {
+  Item item{ CubeState(), true };
+  for (char c : scramble) {
+    uint8_t axis, count;
+    if (parse_move_char(c, axis, count)) {
+      turn_cube_move(item.state, axis * 3 + count - 1);
+    } else if (c != ' ' && c != '\t' && c != '\r') {
+      item.valid = false;
+    }
+  }
+  return item;
+}
+
+bool read_file(const char* path, std::string& data) {
+  FILE* file = strcmp(path, "-") == 0 ? stdin : fopen(path, "rb");
+  if (file == nullptr) {
+    return false;
+  }
+  char buffer[1 << 16];
+  size_t read;
+  while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    data.append(buffer, read);
+  }
+  if (file != stdin) {
+    fclose(file);
+  }
+  return true;
+}
+
+void read_scrambles(const std::string& data, std::vector<Item>& items) {
+  size_t begin = 0;
+  while (begin < data.size()) {
+    size_t end = data.find('\n', begin);
+    end = end == std::string::npos ? data.size() : end;
+    std::string line = data.substr(begin, end - begin);
+    if (line.find_first_not_of(" \t\r") != std::string::npos) {
+      items.push_back(scramble_item(line));
+    }
+    begin = end + 1;
+  }
+}
+
+bool read_states(const std::string& data, std::vector<Item>& items) {
+  if (data.size() % OFFLOAD_STATE_SIZE != 0) {
+    return false;
+  }
+  for (size_t offset = 0; offset < data.size(); offset += OFFLOAD_STATE_SIZE) {
+    const uint8_t* record = reinterpret_cast<const uint8_t*>(data.data() + offset);
+    bool valid = offload_state_valid(record);
+    items.push_back({ valid ? offload_read_state(record) : CubeState(), valid });
+  }
+  return true;
+}
+
+bool save_states(const char* path, const std::vector<Item>& items) {
+  FILE* file = fopen(path, "wb");
+  if (file == nullptr) {
+    return false;
+  }
+  for (const Item& item : items) {
+    if (item.valid) {
+      uint8_t record[OFFLOAD_STATE_SIZE];
+      offload_write_state(item.state, record);
+      fwrite(record, 1, sizeof(record), file);
+    }
+  }
+  return fclose(file) == 0;
+}
+
+// 이 스레드의 cube/container로 항목 하나를 풀고, 해법을 상태에 다시 적용해 검사한 뒤 한 줄을 묶음 출력에 붙입니다.
+void solve_item(const Item& item, uint32_t index, Solver solver, uint8_t frames, Chunk& chunk) {
+  char header[96];
+  if (!item.valid) {
+    snprintf(header, sizeof(header), "%u\tinvalid-input\t0\t0.0\t0\t\n", index);
+    chunk.output += header;
+    chunk.invalid_inputs++;
+    return;
+  }
+  cube = item.state;
+  Clock::time_point begin = Clock::now();
+  bool searched = true;
+  uint32_t nodes = 0;
+  if (solver == Solver::TWO_PHASE) {
+    searched = two_phase_solve();
+  } else if (solver == Solver::THISTLETHWAITE) {
+    searched = thistlethwaite_solve();
+    nodes = tw_node_count;
+  } else if (solver == Solver::NEUTRAL) {
+    solve_color_neutral(frames);
+  } else {
+    solve();
+  }
+  double us = std::chrono::duration<double, std::micro>(Clock::now() - begin).count();
+
+  CubeState check = item.state;
+  uint32_t face_turns = 0;
+  for (char c : container) {
+    uint8_t axis, count;
+    if (parse_move_char(c, axis, count)) {
+      turn_cube_move(check, axis * 3 + count - 1);
+      face_turns++;
+    }
+  }
+  bool valid = check.solved() && !container.overflowed();
+  chunk.invalid_solutions += !valid;
+  chunk.fallbacks += !searched;
+  chunk.face_turns += face_turns;
+  chunk.max_face_turns = std::max(chunk.max_face_turns, face_turns);
+
+  snprintf(header, sizeof(header), "%u\t%s\t%u\t%.1f\t%u\t", index, !valid ? "invalid" : searched ? "ok" : "fallback",
+           face_turns, us, nodes);
+  chunk.output += header;
+  chunk.output.append(container.begin(), container.end());
+  chunk.output += '\n';
+}
+
+// 자기 큐의 앞에서 묶음을 꺼내고, 비었으면 다른 스레드의 큐 뒤에서 훔칩니다. 새 묶음은 생기지 않으므로 모두 비면 끝입니다.
+bool take_chunk(std::vector<WorkQueue>& queues, uint32_t self, uint32_t& chunk) {
+  {
+    std::lock_guard<std::mutex> lock(queues[self].mutex);
+    if (!queues[self].chunks.empty()) {
+      chunk = queues[self].chunks.front();
+      queues[self].chunks.pop_front();
+      return true;
+    }
+  }
+  for (uint32_t offset = 1; offset < queues.size(); ++offset) {
+    WorkQueue& victim = queues[(self + offset) % queues.size()];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.chunks.empty()) {
+      chunk = victim.chunks.back();
+      victim.chunks.pop_back();
+      queues[self].stolen_chunks++;  // 자기 큐의 카운터는 이 스레드만 씁니다.
+      return true;
+    }
+  }
+  return false;
+}
+
+int usage() {
+  fprintf(stderr, "usage: batch_solve [--threads N] [--solver lbl|two-phase|thistlethwaite|neutral] [--frames N] [--cross <table>]\n"
+                  "                   [--states] [--save-states <file>] <input|->\n"
+                  "       batch_solve [options] --random <count> <length> [seed]\n");
+  return 2;
+}
+
+// 10진수 인자 하나를 읽습니다. 끝까지 숫자가 아니거나 32비트를 넘으면 false를 반환합니다.
+bool parse_number(const char* text, uint32_t& value) {
+  char* end;
+  unsigned long parsed = strtoul(text, &end, 10);
+  if (!isdigit(static_cast<unsigned char>(text[0])) || *end != '\0' || parsed > 0xFFFFFFFFul) {
+    return false;
+  }
+  value = parsed;
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  uint32_t thread_count = std::max(1u, std::thread::hardware_concurrency());
+  Solver solver = Solver::LBL;
+  uint8_t frames = CUBE_SYMMETRY_COUNT;
+  bool binary = false;
+  const char* input = nullptr;
+  const char* save_path = nullptr;
+  std::vector<Item> items;
+
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+      if (!parse_number(argv[++i], thread_count) || thread_count == 0) {
+        return usage();
+      }
+    } else if (strcmp(argv[i], "--solver") == 0 && i + 1 < argc) {
+      const char* name = argv[++i];
+      if (strcmp(name, "two-phase") == 0) {
+        solver = Solver::TWO_PHASE;
+      } else if (strcmp(name, "thistlethwaite") == 0) {
+        solver = Solver::THISTLETHWAITE;
+      } else if (strcmp(name, "neutral") == 0) {
+        solver = Solver::NEUTRAL;
+      } else if (strcmp(name, "lbl") != 0) {
+        return usage();
+      }
+    } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      uint32_t value;
+      if (!parse_number(argv[++i], value) || value == 0) {
+        return usage();
+      }
+      frames = std::min<uint32_t>(CUBE_SYMMETRY_COUNT, value);
+    } else if (strcmp(argv[i], "--cross") == 0 && i + 1 < argc) {
+      if (!cross_table_load(argv[++i])) {
+        fprintf(stderr, "batch_solve: cannot read the cross table %s\n", argv[i]);
+        return 1;
+      }
+    } else if (strcmp(argv[i], "--states") == 0) {
+      binary = true;
+    } else if (strcmp(argv[i], "--save-states") == 0 && i + 1 < argc) {
+      save_path = argv[++i];
+    } else if (strcmp(argv[i], "--random") == 0 && i + 2 < argc) {
+      uint32_t count, length, seed = 1;
+      if (!parse_number(argv[i + 1], count) || !parse_number(argv[i + 2], length) || count == 0 || length == 0) {
+        return usage();
+      }
+      i += 2;
+      if (i + 1 < argc && argv[i + 1][0] != '-' && !parse_number(argv[++i], seed)) {
+        return usage();
+      }
+      std::mt19937 rng(seed);
+      for (uint32_t n = 0; n < count; ++n) {
+        Item item{ CubeState(), true };
+        for (uint32_t k = 0; k < length; ++k) {
+          turn_cube_move(item.state, rng() % 18);
+        }
+        items.push_back(item);
+      }
+      input = "--random";
+    } else if (input == nullptr && (argv[i][0] != '-' || argv[i][1] == '\0')) {
+      input = argv[i];
+    } else {
+      return usage();
+    }
+  }
+  if (input == nullptr) {
+    return usage();
+  }
+  if (strcmp(input, "--random") != 0) {
+    std::string data;
+    if (!read_file(input, data)) {
+      fprintf(stderr, "batch_solve: cannot read %s\n", input);
+      return 1;
+    }
+    if (binary && !read_states(data, items)) {
+      fprintf(stderr, "batch_solve: %s is not a multiple of %u bytes\n", input, OFFLOAD_STATE_SIZE);
+      return 1;
+    }
+    if (!binary) {
+      read_scrambles(data, items);
+    }
+  }
+  if (save_path != nullptr && !save_states(save_path, items)) {
+    fprintf(stderr, "batch_solve: cannot write %s\n", save_path);
+    return 1;
+  }
+  if (solver == Solver::TWO_PHASE) {
+    two_phase_init();  // 표는 스레드들이 함께 읽기만 하므로 시작 전에 만들어 둡니다.
+  }
+
+  const uint32_t item_count = items.size();
+  const uint32_t chunk_count = (item_count + BATCH_CHUNK - 1) / BATCH_CHUNK;
+  std::unique_ptr<Chunk[]> chunks(new Chunk[chunk_count]);
+  std::vector<WorkQueue> queues(thread_count);
+  for (uint32_t chunk = 0; chunk < chunk_count; ++chunk) {
+    queues[chunk % thread_count].chunks.push_back(chunk);
+  }
+
+  std::mutex done_mutex;
+  std::condition_variable done_condition;
+  Clock::time_point begin = Clock::now();
+  std::vector<std::thread> workers;
+  for (uint32_t self = 0; self < thread_count; ++self) {
+    workers.emplace_back([&, self] {
+      uint32_t chunk;
+      while (take_chunk(queues, self, chunk)) {
+        uint32_t first = chunk * BATCH_CHUNK;
+        uint32_t last = std::min(item_count, first + BATCH_CHUNK);
+        for (uint32_t index = first; index < last; ++index) {
+          solve_item(items[index], index, solver, frames, chunks[chunk]);
+        }
+        queues[self].solved_chunks++;
+        chunks[chunk].done.store(true, std::memory_order_release);
+        { std::lock_guard<std::mutex> lock(done_mutex); }
+        done_condition.notify_one();
+      }
+    });
+  }
+
+  uint32_t invalid_inputs = 0, invalid_solutions = 0, fallbacks = 0, max_face_turns = 0;
+  uint64_t face_turns = 0;
+  for (uint32_t chunk = 0; chunk < chunk_count; ++chunk) {
+    Chunk& current = chunks[chunk];
+    if (!current.done.load(std::memory_order_acquire)) {
+      std::unique_lock<std::mutex> lock(done_mutex);
+      done_condition.wait(lock, [&] { return current.done.load(std::memory_order_acquire); });
+    }
+    fwrite(current.output.data(), 1, current.output.size(), stdout);
+    std::string().swap(current.output);
+    invalid_inputs += current.invalid_inputs;
+    invalid_solutions += current.invalid_solutions;
+    fallbacks += current.fallbacks;
+    face_turns += current.face_turns;
+    max_face_turns = std::max(max_face_turns, current.max_face_turns);
+  }
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+  fflush(stdout);
+  double seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+
+  uint32_t solved = item_count - invalid_inputs;
+  fprintf(stderr, "items            : %u (solver %s, %u threads, chunk %u)\n", item_count,
+          solver_names[static_cast<uint8_t>(solver)], thread_count, BATCH_CHUNK);
+  fprintf(stderr, "invalid inputs   : %u\n", invalid_inputs);
+  fprintf(stderr, "invalid solutions: %u\n", invalid_solutions);
+  fprintf(stderr, "fallbacks        : %u\n", fallbacks);
+  fprintf(stderr, "face turns       : mean %.2f, max %u\n", solved == 0 ? 0.0 : static_cast<double>(face_turns) / solved,
+          max_face_turns);
+  fprintf(stderr, "wall time        : %.3f s, %.0f items/s\n", seconds, item_count / seconds);
+  for (uint32_t self = 0; self < thread_count; ++self) {
+    fprintf(stderr, "  thread %-3u      : %u chunks (%u stolen)\n", self, queues[self].solved_chunks, queues[self].stolen_chunks);
+  }
+  return invalid_solutions == 0 ? 0 : 1;
+}
@@ -0,0 +1,160 @@
+/* 상태 묶음 엔진 검사 및 벤치마크
+ *
+ * 먼저 커널(스칼라, SSE2, AVX2 중 이 CPU에서 쓸 수 있는 것)마다 BatchCube의 결과를 rotate()와 비교합니다.
+ * 무작위 상태들을 묶음에 넣고(개수는 BATCH_CUBE_ALIGN의 배수가 아니게 해서 남는 칸도 지납니다), 회전마다
+ * 상태 하나하나를 cube에 넣고 rotate()한 것과 묶음에서 꺼낸 상태가 같은지 확인합니다.
+ * 이 검사는 언제나 먼저 하며, 다른 점이 하나라도 있으면 속도를 재지 않고 종료 코드 1로 끝납니다. --verify를 주면 검사만 하고 끝냅니다.
+ *
+ * 이어서 커널마다 상태 묶음에 18가지 회전을 번갈아 적용하며 초당 상태-회전 수를 재고,
+ * 상태 하나씩 turn_cube_move()와 rotate()로 돌린 것과 비교합니다.
+ *
+ * 사용법: bench_batch [상태 수=65536] [반복 수=2000] [시드=1] [--verify]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Arduino.h"
+#include "BatchCube.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr BatchKernel kernels[3] = { BatchKernel::SCALAR, BatchKernel::SSE2, BatchKernel::AVX2 };
+
+CubeState random_state(std::mt19937& rng) {
+  CubeState state;
+  for (int i = 0; i < 30; ++i) {
+    turn_cube_move(state, rng() % MOVE_COUNT);
+  }
+  return state;
+}
+
+// 묶음과 rotate()의 결과가 다른 상태-회전 수를 반환합니다.
+uint32_t verify(BatchKernel kernel, uint32_t seed) {
+  constexpr uint32_t STATES = 1000;
+  constexpr uint32_t MOVES = 200;
+  std::mt19937 rng(seed);
+  std::vector<CubeState> expected(STATES);
+  BatchCube batch(STATES), next(STATES);
+  CubeState padding;  // 남는 칸은 맞춰진 상태에서 같은 회전들을 지납니다.
+  uint32_t mismatches = 0;
+  for (uint32_t i = 0; i < STATES; ++i) {
+    expected[i] = random_state(rng);
+    batch.set(i, expected[i]);
+    mismatches += batch.get(i) != expected[i];
+  }
+  for (uint32_t step = 0; step < MOVES; ++step) {
+    uint8_t move = step < MOVE_COUNT ? step : rng() % MOVE_COUNT;  // 18가지 회전을 모두 한 번씩 지난 뒤 무작위로 고릅니다.
+    batch_apply(batch, move, next, kernel);
+    std::swap(batch, next);
+    turn_cube_move(padding, move);
+    for (uint32_t i = 0; i < STATES; ++i) {
+      cube = expected[i];
+      rotate(static_cast<Color>(move_axis(move)), move_count(move));
+      container.clear();
+      expected[i] = cube;
+      if (batch.get(i) != expected[i] && mismatches++ == 0) {
+        printf("  first mismatch: state %u after %u moves\n", i, step + 1);
+      }
+    }
+  }
+  for (size_t i = STATES; i < batch.stride; ++i) {
+    mismatches += batch.get(i) != padding;
+  }
+  return mismatches;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  bool verify_only = false;
+  int positional = 1;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--verify") == 0) {
+      verify_only = true;
+    } else {
+      argv[positional++] = argv[i];
+    }
+  }
+  argc = positional;
+  const uint32_t state_count = argc > 1 ? strtoul(argv[1], nullptr, 10) : 65536;
+  const uint32_t rounds = argc > 2 ? strtoul(argv[2], nullptr, 10) : 2000;
+  const uint32_t seed = argc > 3 ? strtoul(argv[3], nullptr, 10) : 1;
+
+  // 1. rotate()와 비교
+  uint32_t failures = 0;
+  for (BatchKernel kernel : kernels) {
+    if (!batch_kernel_supported(kernel)) {
+      printf("verify %-6s    : not supported on this CPU\n", batch_kernel_names[static_cast<uint8_t>(kernel)]);
+      continue;
+    }
+    uint32_t mismatches = verify(kernel, seed);
+    printf("verify %-6s    : %u mismatches against rotate()\n", batch_kernel_names[static_cast<uint8_t>(kernel)], mismatches);
+    failures += mismatches;
+  }
+  if (failures != 0) {
+    printf("batch engine disagrees with rotate(); not timing\n");
+    return 1;
+  }
+  if (verify_only) {
+    return 0;
+  }
+
+  // 2. 초당 상태-회전 수
+  std::mt19937 rng(seed);
+  BatchCube batch(state_count), next(state_count);
+  std::vector<CubeState> states(state_count);
+  for (uint32_t i = 0; i < state_count; ++i) {
+    states[i] = random_state(rng);
+    batch.set(i, states[i]);
+  }
+  printf("states           : %u (%zu bytes per batch), %u rounds of one move\n", state_count, batch.data.size(), rounds);
+  for (BatchKernel kernel : kernels) {
+    if (!batch_kernel_supported(kernel)) {
+      continue;
+    }
+    Clock::time_point begin = Clock::now();
+    for (uint32_t round = 0; round < rounds; ++round) {
+      batch_apply(batch, round % MOVE_COUNT, next, kernel);
+      std::swap(batch, next);
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+    printf("batch %-6s     : %8.1f M state-moves/s%s\n", batch_kernel_names[static_cast<uint8_t>(kernel)],
+           static_cast<double>(state_count) * rounds / seconds / 1e6, kernel == batch_cube_kernel ? " (default)" : "");
+  }
+
+  // 비교용으로 상태 하나씩 돌립니다. 같은 양을 돌리면 오래 걸리므로 반복 수를 줄입니다.
+  const uint32_t single_rounds = std::max(1u, rounds / 20);
+  Clock::time_point begin = Clock::now();
+  for (uint32_t round = 0; round < single_rounds; ++round) {
+    for (CubeState& state : states) {
+      turn_cube_move(state, round % MOVE_COUNT);
+    }
+  }
+  double seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+  printf("turn_cube_move() : %8.1f M state-moves/s\n", static_cast<double>(state_count) * single_rounds / seconds / 1e6);
+
+  begin = Clock::now();
+  for (uint32_t round = 0; round < single_rounds; ++round) {
+    for (CubeState& state : states) {
+      cube = state;
+      rotate(static_cast<Color>(move_axis(round % MOVE_COUNT)), move_count(round % MOVE_COUNT));
+      container.clear();
+      state = cube;
+    }
+  }
+  seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+  printf("rotate()         : %8.1f M state-moves/s\n", static_cast<double>(state_count) * single_rounds / seconds / 1e6);
+
+  uint32_t checksum = 0;
+  for (uint32_t i = 0; i < state_count; ++i) {
+    checksum ^= batch.get(i).hash() ^ states[i].hash();
+  }
+  printf("checksum         : %08x\n", checksum);
+  return 0;
+}
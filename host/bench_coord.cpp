@@ -0,0 +1,90 @@
+/* 좌표 엔진 검사 및 벤치마크
+ *
+ * 무작위 회전을 rotate()의 배열 상태와 CoordCube의 좌표 상태에 동시에 적용하며
+ * 매 회전마다 두 상태가 같은지, 좌표 -> 배열 -> 좌표 변환이 원래대로 돌아오는지 확인합니다.
+ * 이어서 두 엔진의 초당 회전 수를 비교합니다.
+ *
+ * 사용법: bench_coord [회전 수=10000000] [시드=1]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Arduino.h"
+#include "CoordCube.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+bool same_coord(const CoordCube& a, const CoordCube& b) {
+  return a.twist == b.twist && a.flip == b.flip && a.corner_perm == b.corner_perm
+         && a.edge4[0] == b.edge4[0] && a.edge4[1] == b.edge4[1] && a.edge4[2] == b.edge4[2];
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const uint32_t move_total = argc > 1 ? strtoul(argv[1], nullptr, 10) : 10000000;
+  const uint32_t seed = argc > 2 ? strtoul(argv[2], nullptr, 10) : 1;
+
+  Clock::time_point init_begin = Clock::now();
+  coord_init();
+  double init_seconds = std::chrono::duration<double>(Clock::now() - init_begin).count();
+
+  std::mt19937 rng(seed);
+  std::vector<uint8_t> moves(1 << 16);
+  for (uint8_t& move : moves) {
+    move = rng() % MOVE_COUNT;
+  }
+
+  // 1. 두 엔진의 결과 비교
+  uint32_t mismatches = 0;
+  reset_cube();
+  CoordCube coord = coord_from_cube();
+  for (uint32_t i = 0; i < 1000000; ++i) {
+    uint8_t move = moves[i % moves.size()];
+    rotate(static_cast<Color>(move_axis(move)), move_count(move));
+    coord_move(coord, move);
+    container.clear();
+
+    CoordCube expected = coord_from_cube();
+    uint8_t c_pos[8], c_ori[8], e_pos[12], e_ori[12];
+    coord_to_cubies(coord, c_pos, c_ori, e_pos, e_ori);
+    bool round_trip = CubeState::pack(c_pos, c_ori, e_pos, e_ori) == cube;
+    if (!same_coord(coord, expected) || !round_trip) {
+      if (mismatches++ == 0) {
+        printf("first mismatch after %u moves\n", i + 1);
+      }
+      coord = expected;
+    }
+  }
+
+  // 2. 속도 비교
+  reset_cube();
+  Clock::time_point rotate_begin = Clock::now();
+  for (uint32_t i = 0; i < move_total; ++i) {
+    uint8_t move = moves[i % moves.size()];
+    rotate(static_cast<Color>(move_axis(move)), move_count(move));
+    if (container.length() > 512) {
+      container.clear();
+    }
+  }
+  double rotate_seconds = std::chrono::duration<double>(Clock::now() - rotate_begin).count();
+
+  coord = CoordCube{};
+  Clock::time_point coord_begin = Clock::now();
+  for (uint32_t i = 0; i < move_total; ++i) {
+    coord_move(coord, moves[i % moves.size()]);
+  }
+  double coord_seconds = std::chrono::duration<double>(Clock::now() - coord_begin).count();
+
+  printf("table init       : %.1f ms\n", init_seconds * 1000);
+  printf("mismatches       : %u\n", mismatches);
+  printf("rotate() moves/s : %.0f (checksum %u)\n", move_total / rotate_seconds, cube.corner_pos(0) + cube.edge_pos(0));
+  printf("coord moves/s    : %.0f (checksum %u)\n", move_total / coord_seconds, coord.twist + coord.edge4[0]);
+
+  return mismatches == 0 ? 0 : 1;
+}
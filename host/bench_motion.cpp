@@ -0,0 +1,179 @@
+/* 모터 위치 제어 시뮬레이션
+ *
+ * PhysicalCube.h의 motor_start()/motor_update()를 간단한 DC 모터 모델 위에서 돌려
+ * 회전 종류(90도 시계, 180도, 90도 반시계)별로 정착 시간과 오버슈트를 보고합니다.
+ * 비교를 위해 예전 방식(PWM 50 고정, ±3 안에 들어오면 정지)도 같은 모델로 측정합니다.
+ *
+ * 모델: 최대 PWM에서 최고 속도(센서 단위/초)에 시정수(초)로 다가가고,
+ * PWM이 MODEL_DEAD_PWM보다 작으면 마찰로 MODEL_COAST_TAU 시정수로 멈춥니다. 센서는 정수로 잘리고 ±1 잡음이 섞입니다.
+ * 시간은 host_manual_clock으로 루프마다 MODEL_LOOP_US씩 진행합니다.
+ *
+ * 게인은 기본 모델(5000, 0.03)에 맞춰져 있으므로, 모델을 바꿔 실제 모터와 차이가 날 때의 여유도 확인할 수 있습니다.
+ *
+ * 사용법: bench_motion [회전 수=300] [시드=1] [최고 속도=5000] [시정수=0.03]
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Arduino.h"
+#include "PhysicalCube.h"
+
+namespace {
+
+float model_full_speed = 5000.0f;  // 센서 단위/초
+float model_tau = 0.03f;           // 초
+constexpr float MODEL_COAST_TAU = 0.02f;
+constexpr int MODEL_DEAD_PWM = 20;
+constexpr uint32_t MODEL_LOOP_US = 500;
+constexpr uint32_t MODEL_TIMEOUT_US = 3000000;
+
+struct MotorModel {
+  float position = 0;
+  float velocity = 0;
+};
+MotorModel models[6];
+std::mt19937 noise_rng(7);
+
+// 핀 출력에서 PWM(-255..255)을 읽어 모델을 한 루프만큼 진행하고 센서값을 갱신합니다.
+void model_step() {
+  const float dt = MODEL_LOOP_US * 1e-6f;
+  for (int axis = 0; axis < 6; ++axis) {
+    int in1 = host_pin_value[MOTOR_DRIVER_IN1[axis]];
+    int pwm = host_pin_value[MOTOR_DRIVER_IN2[axis]] == LOW ? in1 : -(255 - in1);
+    MotorModel& model = models[axis];
+    if (abs(pwm) < MODEL_DEAD_PWM) {
+      model.velocity -= model.velocity * dt / MODEL_COAST_TAU;
+    } else {
+      model.velocity += (pwm / 255.0f * model_full_speed - model.velocity) * dt / model_tau;
+    }
+    model.position += model.velocity * dt;
+    int sensor = static_cast<int>(floorf(model.position)) + static_cast<int>(noise_rng() % 3) - 1;
+    host_pin_value[SENSOR_OUT[axis]] = (sensor % 1024 + 1024) % 1024;
+  }
+  host_clock_us += MODEL_LOOP_US;
+}
+
+// 멈춘 뒤 모터가 완전히 설 때까지 진행해서 최종 위치의 목표 대비 오차를 반환합니다.
+float coast_to_rest(int axis, float target, float direction, float& overshoot) {
+  for (int i = 0; i < 200; ++i) {
+    model_step();
+    overshoot = std::max(overshoot, (models[axis].position - target) * direction);
+  }
+  return models[axis].position - target;
+}
+
+struct Result {
+  std::vector<uint32_t> settle_us;
+  std::vector<float> overshoot;
+  std::vector<float> final_error;
+  uint32_t misses = 0;  // 멈춘 뒤 목표에서 MOTOR_OVERLAP_WINDOW보다 멀어서 옆면이 걸리는 경우
+
+  void print(const char* name) {
+    std::sort(settle_us.begin(), settle_us.end());
+    std::sort(overshoot.begin(), overshoot.end());
+    std::sort(final_error.begin(), final_error.end());
+    size_t n = settle_us.size();
+    printf("  %-16s settle p50 %6.1f ms, max %6.1f ms | overshoot p50 %5.1f, max %5.1f | final error p50 %5.1f, max %5.1f"
+           " | misses %u/%zu\n",
+           name, settle_us[n / 2] / 1000.0, settle_us[n - 1] / 1000.0, overshoot[n / 2], overshoot[n - 1],
+           final_error[n / 2], final_error[n - 1], misses, n);
+  }
+};
+
+void record(Result& result, uint32_t settle_us, float overshoot, float final_error) {
+  result.settle_us.push_back(settle_us);
+  result.overshoot.push_back(std::max(0.0f, overshoot));
+  result.final_error.push_back(fabsf(final_error));
+  result.misses += fabsf(final_error) > MOTOR_OVERLAP_WINDOW;
+}
+
+// 예전 motor_write(): PWM 50으로 돌다가 ±3 안에 들어오면 멈춥니다.
+void run_bang_bang(Result& result, int axis, int amount) {
+  float start = models[axis].position;
+  // 예전 방식은 180도를 반시계방향으로 돌립니다.
+  float target = start + (amount >= 512 ? amount - 1024 : amount);
+  float direction = amount >= 512 ? -1 : 1;
+  int target_rotate = (static_cast<int>(roundf(target)) % 1024 + 1024) % 1024;
+  uint64_t begin = host_clock_us;
+  float overshoot = 0;
+  while (host_clock_us - begin < MODEL_TIMEOUT_US) {
+    int delta_rotate = (target_rotate - sensor_read(axis) + 1024) % 1024;
+    if (delta_rotate <= 3 || delta_rotate >= 1021) {
+      break;
+    }
+    if (delta_rotate < 512) {
+      motor_rotate_cw(axis, 50);
+    } else {
+      motor_rotate_ccw(axis, 50);
+    }
+    model_step();
+    overshoot = std::max(overshoot, (models[axis].position - target) * direction);
+  }
+  uint32_t settle_us = host_clock_us - begin;
+  motor_stop(axis);
+  float final_error = coast_to_rest(axis, target, direction, overshoot);
+  record(result, settle_us, overshoot, final_error);
+}
+
+void run_profile(Result& result, int axis, int amount) {
+  float start = models[axis].position;
+  float target = start + (amount > 512 ? amount - 1024 : amount);
+  float direction = amount > 512 ? -1 : 1;
+  uint64_t begin = host_clock_us;
+  float overshoot = 0;
+  sensor_refresh();
+  motor_start(axis, amount);
+  while (motors[axis].state != MotorState::IDLE && host_clock_us - begin < MODEL_TIMEOUT_US) {
+    model_step();
+    sensor_refresh();
+    motor_update();
+    overshoot = std::max(overshoot, (models[axis].position - target) * direction);
+  }
+  uint32_t settle_us = host_clock_us - begin;
+  motor_stop(axis);
+  float final_error = coast_to_rest(axis, target, direction, overshoot);
+  record(result, settle_us, overshoot, final_error);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const uint32_t move_total = argc > 1 ? strtoul(argv[1], nullptr, 10) : 300;
+  std::mt19937 rng(argc > 2 ? strtoul(argv[2], nullptr, 10) : 1);
+  model_full_speed = argc > 3 ? strtof(argv[3], nullptr) : model_full_speed;
+  model_tau = argc > 4 ? strtof(argv[4], nullptr) : model_tau;
+  host_manual_clock = true;
+  sensor_begin();
+
+  const int amounts[3] = { 256, 512, 768 };
+  const char* const names[3] = { "quarter cw", "half", "quarter ccw" };
+  Result bang_bang[3], profile[3];
+  for (uint32_t n = 0; n < move_total; ++n) {
+    int axis = rng() % 6;
+    int kind = rng() % 3;
+    // 두 방식이 같은 조건에서 시작하도록 매번 면 위치에 정확히 맞춰 둡니다.
+    models[axis] = MotorModel{ static_cast<float>(get_cube_area(sensor_read(axis)) * 256), 0 };
+    model_step();
+    run_bang_bang(bang_bang[kind], axis, amounts[kind]);
+    models[axis] = MotorModel{ static_cast<float>(get_cube_area(sensor_read(axis)) * 256), 0 };
+    model_step();
+    run_profile(profile[kind], axis, amounts[kind]);
+  }
+
+  printf("moves: %u (model %.0f/s, tau %.3f s, loop %u us)\n", move_total, model_full_speed, model_tau, MODEL_LOOP_US);
+  printf("profile: max speed %.0f, accel %.0f, kp %.2f, ki %.2f, kd %.3f, kv %.4f, ka %.4f\n", MOTOR_MAX_SPEED,
+         MOTOR_ACCEL, MOTOR_KP, MOTOR_KI, MOTOR_KD, MOTOR_KV, MOTOR_KA);
+  for (int kind = 0; kind < 3; ++kind) {
+    printf("%s\n", names[kind]);
+    bang_bang[kind].print("bang-bang (50)");
+    profile[kind].print("profile + PID");
+  }
+  uint32_t misses = 0;
+  for (const Result& result : profile) {
+    misses += result.misses;
+  }
+  return misses == 0 ? 0 : 1;
+}
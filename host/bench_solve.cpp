@@ -0,0 +1,289 @@
+/* solve() 벤치마크
+ *
+ * 시드가 고정된 무작위 스크램블을 만들어 solve()를 반복 실행하고 아래 항목을 보고합니다.
+ *   - solve() 한 번의 소요 시간(p50/p99/max)
+ *   - 단계별 쿼터 턴 수(정리 전)와 마지막 정리 단계 후의 최종 해법 길이
+ *   - rotate() 초당 호출 수
+ * 해법을 스크램블 상태에 다시 적용해서 실제로 큐브가 맞춰지는지도 함께 검사합니다.
+ *
+ * 해법 종류로 two-phase를 주면 solve() 대신 TwoPhase.h의 two_phase_solve()를 측정합니다.
+ * thistlethwaite를 주면 Thistlethwaite.h의 thistlethwaite_solve()를 측정하고 해법마다 탐색 노드 수를 함께 보고합니다.
+ * 두 경우 모두 단계별 회전 수는 예산을 넘겨 solve()로 대신한 경우에만 기록됩니다.
+ * 마지막에 history를 주면 스크램블을 history_record()로 기록해 두고, 해법을 구한 뒤 history_shortcut()으로
+ * 되돌리기가 더 짧으면 바꿉니다(장치의 기본 동작). 되돌리기를 고른 횟수를 함께 보고합니다.
+ *
+ * --cross <표 파일>을 주면(자리는 상관없습니다) cross_gen이 만든 흰 십자가 표를 읽어 solve()의 1단계를 최적으로 풉니다.
+ * neutral을 주면 solve_color_neutral()로 대칭 --frames개(기본 48, 24면 회전만)의 시점에서 풀어 가장 짧은 해법을 측정합니다.
+ * 단계별 회전 수는 고른 시점의 것이며, 시작할 때 대칭 48가지가 모두 만들어지는지 확인하고 원래 시점을 고른 횟수를 함께 보고합니다.
+ *
+ * 사용법: bench_solve [스크램블 수=1000000] [시드=1] [스크램블 길이=25] [해법 종류=lbl|two-phase|thistlethwaite|neutral] [history]
+ *                     [--cross <표 파일>] [--frames N]
+ * 숫자 자리에 숫자가 아닌 것을 주거나 모르는 해법 종류, 남는 인자가 있으면 사용법을 출력하고 종료 코드 2로 끝납니다.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Arduino.h"
+
+constexpr int SOLVE_STAGE_COUNT = 6;  // 1~5단계와 종료 지점
+uint16_t stage_marks[SOLVE_STAGE_COUNT + 1];
+#define SOLVE_STAGE_HOOK(stage) (stage_marks[(stage)] = container.length())
+
+#include "CrossFile.h"
+#include "Thistlethwaite.h"
+#include "TwoPhase.h"
+
+static_assert(SOLVE_STAGE_COUNT == SOLVE_FINAL_STAGE + 1, "stage_marks must cover every stage of solve()");
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Stats {
+  std::vector<uint32_t> values;
+
+  void add(uint32_t value) {
+    values.push_back(value);
+  }
+  uint32_t percentile(double p) {
+    if (values.empty()) {
+      return 0;
+    }
+    size_t index = static_cast<size_t>(p * (values.size() - 1));
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+  }
+  uint32_t max() const {
+    return values.empty() ? 0 : *std::max_element(values.begin(), values.end());
+  }
+  double mean() const {
+    double sum = 0;
+    for (uint32_t value : values) {
+      sum += value;
+    }
+    return values.empty() ? 0 : sum / values.size();
+  }
+};
+
+// 해법 문자 하나를 가상 큐브에 적용합니다. 해법 알파벳이 아닌 문자는 무시합니다.
+void apply_move_char(char c) {
+  uint8_t axis, count;
+  if (parse_move_char(c, axis, count)) {
+    rotate(static_cast<Color>(axis), count);
+  }
+}
+
+const char* const stage_names[SOLVE_STAGE_COUNT - 1] = {
+  "1 white cross",
+  "2 first two layers",
+  "3 LL orientation",
+  "4 LL permutation",
+  "5 cleanup (removed)",
+};
+
+int usage() {
+  fprintf(stderr, "usage: bench_solve [count=1000000] [seed=1] [length=25] [lbl|two-phase|thistlethwaite|neutral] [history]\n"
+                  "                   [--cross <table>] [--frames N]\n");
+  return 2;
+}
+
+// 10진수 인자 하나를 읽습니다. 끝까지 숫자가 아니거나 32비트를 넘으면 false를 반환합니다.
+bool parse_number(const char* text, uint32_t& value) {
+  char* end;
+  unsigned long parsed = strtoul(text, &end, 10);
+  if (!isdigit(static_cast<unsigned char>(text[0])) || *end != '\0' || parsed > 0xFFFFFFFFul) {
+    return false;
+  }
+  value = parsed;
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  // --cross <파일>, --frames N을 빼고 남은 인자를 자리 순서대로 읽습니다.
+  int positional = 1;
+  uint8_t frames = CUBE_SYMMETRY_COUNT;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      uint32_t value;
+      if (!parse_number(argv[++i], value)) {
+        return usage();
+      }
+      frames = std::min<uint32_t>(CUBE_SYMMETRY_COUNT, std::max(1u, value));
+      continue;
+    }
+    if (strcmp(argv[i], "--cross") == 0 && i + 1 < argc) {
+      if (!cross_table_load(argv[++i])) {
+        fprintf(stderr, "bench_solve: cannot read the cross table %s\n", argv[i]);
+        return 1;
+      }
+    } else {
+      argv[positional++] = argv[i];
+    }
+  }
+  argc = positional;
+  uint32_t scramble_count = 1000000;
+  uint32_t seed = 1;
+  uint32_t scramble_length = 25;
+  if ((argc > 1 && !parse_number(argv[1], scramble_count)) || (argc > 2 && !parse_number(argv[2], seed)) ||
+      (argc > 3 && !parse_number(argv[3], scramble_length))) {
+    return usage();
+  }
+  const char* const solver = argc > 4 ? argv[4] : "lbl";
+  const bool use_two_phase = strcmp(solver, "two-phase") == 0;
+  const bool use_thistlethwaite = strcmp(solver, "thistlethwaite") == 0;
+  const bool use_neutral = strcmp(solver, "neutral") == 0;
+  const bool use_history = argc > 5 && strcmp(argv[5], "history") == 0;
+  if ((!use_two_phase && !use_thistlethwaite && !use_neutral && strcmp(solver, "lbl") != 0) ||
+      (argc > 5 && !use_history) || argc > 6) {
+    return usage();
+  }
+
+  if (use_two_phase) {
+    two_phase_init();
+  }
+  for (uint8_t index = 0; index < CUBE_SYMMETRY_COUNT && use_neutral; ++index) {
+    CubeSymmetry symmetry;
+    if (!cube_symmetry(index, symmetry)) {
+      fprintf(stderr, "bench_solve: symmetry %u does not commute with the face turns\n", index);
+      return 1;
+    }
+  }
+
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> axis_dist(0, 5);
+  std::uniform_int_distribution<int> count_dist(1, 3);
+
+  Stats solve_ns;
+  Stats stage_moves[SOLVE_STAGE_COUNT - 1];
+  Stats solution_moves;
+  Stats solution_face_turns;  // 180도 회전을 1회로 센 길이
+  Stats solution_steps;       // 마주 보는 면을 동시에 돌릴 때의 모터 단계 수(parallel_step_end())
+  Stats search_nodes;
+  uint32_t failures = 0;
+  uint32_t overflows = 0;
+  uint32_t fallbacks = 0;
+  uint32_t shortcuts = 0;
+  uint32_t identity_frames = 0;
+
+  for (uint32_t n = 0; n < scramble_count; ++n) {
+    reset_cube();
+    history_reset();
+    for (uint32_t i = 0; i < scramble_length; ++i) {
+      uint8_t axis = axis_dist(rng), count = count_dist(rng);
+      rotate(static_cast<Color>(axis), count);
+      history_record(axis, count);
+    }
+    CubeState scrambled = cube;
+
+    stage_marks[1] = 0;
+    stage_marks[SOLVE_STAGE_COUNT] = 0;
+    Clock::time_point begin = Clock::now();
+    if (use_two_phase) {
+      fallbacks += !two_phase_solve();
+    } else if (use_thistlethwaite) {
+      fallbacks += !thistlethwaite_solve();
+      search_nodes.add(tw_node_count);
+    } else if (use_neutral) {
+      identity_frames += solve_color_neutral(frames) == 0;
+    } else {
+      solve();
+    }
+    shortcuts += use_history && history_shortcut(scrambled);
+    Clock::time_point end = Clock::now();
+    bool stages_recorded = stage_marks[SOLVE_STAGE_COUNT] != 0;
+    overflows += container.overflowed();
+    solve_ns.add(static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()));
+
+    for (int stage = 0; stage < SOLVE_FINAL_STAGE - 1 && stages_recorded; ++stage) {
+      stage_moves[stage].add(stage_marks[stage + 2] - stage_marks[stage + 1]);
+    }
+
+    // 정리 단계 후의 실제 해법 길이입니다. 180도 회전은 쿼터 턴 2회, 면 회전 1회로 셉니다.
+    MoveBuffer solution = container;
+    uint32_t length = 0;
+    uint32_t face_turns = 0;
+    for (char c : solution) {
+      uint8_t axis, count;
+      if (parse_move_char(c, axis, count)) {
+        length += count == 2 ? 2 : 1;
+        face_turns++;
+      }
+    }
+    if (stages_recorded) {
+      stage_moves[SOLVE_FINAL_STAGE - 1].add(stage_marks[SOLVE_FINAL_STAGE] - length);
+    }
+    uint32_t steps = 0;
+    for (uint16_t i = 0; i < solution.length(); i = parallel_step_end(solution, i)) {
+      steps++;
+    }
+    solution_moves.add(length);
+    solution_steps.add(steps);
+    solution_face_turns.add(face_turns);
+
+    cube = scrambled;
+    for (char c : solution) {
+      apply_move_char(c);
+    }
+    failures += !cube.solved();
+  }
+
+  // rotate()만 따로 측정합니다. container가 계속 커지지 않도록 주기적으로 비웁니다.
+  constexpr uint32_t rotate_calls = 10000000;
+  std::vector<uint8_t> axes(4096);
+  for (uint8_t& axis : axes) {
+    axis = axis_dist(rng);
+  }
+  reset_cube();
+  Clock::time_point rotate_begin = Clock::now();
+  for (uint32_t i = 0; i < rotate_calls; ++i) {
+    rotate(static_cast<Color>(axes[i % axes.size()]), 1);
+    if (i % 1024 == 1023) {
+      container.clear();
+    }
+  }
+  double rotate_seconds = std::chrono::duration<double>(Clock::now() - rotate_begin).count();
+
+  printf("scrambles        : %u (seed %u, length %u, solver %s%s)\n", scramble_count, seed, scramble_length,
+         use_two_phase ? "two-phase" : use_thistlethwaite ? "thistlethwaite" : use_neutral ? "neutral" : "lbl", cross_table_ready() ? ", cross table" : "");
+  if (use_two_phase) {
+    printf("two-phase budget : %u moves, %u ms, fallbacks to solve(): %u\n", TWO_PHASE_MAX_LENGTH,
+           TWO_PHASE_TIME_BUDGET_MS, fallbacks);
+  }
+  if (use_thistlethwaite) {
+    printf("thistlethwaite   : budget %u nodes, fallbacks to solve(): %u\n", THISTLETHWAITE_NODE_BUDGET, fallbacks);
+    printf("search nodes     : p50 %u, p99 %u, max %u, mean %.1f\n", search_nodes.percentile(0.50),
+           search_nodes.percentile(0.99), search_nodes.max(), search_nodes.mean());
+  }
+  if (use_neutral) {
+    printf("neutral frames   : %u, original frame kept: %u\n", frames, identity_frames);
+  }
+  if (use_history) {
+    printf("history          : capacity %u, shortcuts taken: %u\n", HISTORY_CAPACITY, shortcuts);
+  }
+  printf("invalid solutions: %u\n", failures);
+  printf("buffer overflows : %u (capacity %u)\n", overflows, MOVE_BUFFER_CAPACITY);
+  printf("solve() time     : p50 %.2f us, p99 %.2f us, max %.2f us, mean %.2f us\n",
+         solve_ns.percentile(0.50) / 1000.0, solve_ns.percentile(0.99) / 1000.0,
+         solve_ns.max() / 1000.0, solve_ns.mean() / 1000.0);
+  printf("quarter turns per stage (mean / p50 / p99 / max):\n");
+  for (int stage = 0; stage < SOLVE_STAGE_COUNT - 1; ++stage) {
+    printf("  %-22s %7.2f %5u %5u %5u\n", stage_names[stage], stage_moves[stage].mean(),
+           stage_moves[stage].percentile(0.50), stage_moves[stage].percentile(0.99), stage_moves[stage].max());
+  }
+  printf("  %-22s %7.2f %5u %5u %5u\n", "solution (quarter)", solution_moves.mean(),
+         solution_moves.percentile(0.50), solution_moves.percentile(0.99), solution_moves.max());
+  printf("  %-22s %7.2f %5u %5u %5u\n", "solution (face turns)", solution_face_turns.mean(),
+         solution_face_turns.percentile(0.50), solution_face_turns.percentile(0.99), solution_face_turns.max());
+  printf("  %-22s %7.2f %5u %5u %5u\n", "solution (motor steps)", solution_steps.mean(),
+         solution_steps.percentile(0.50), solution_steps.percentile(0.99), solution_steps.max());
+  printf("rotate() calls/s : %.0f\n", rotate_calls / rotate_seconds);
+
+  return failures == 0 ? 0 : 1;
+}
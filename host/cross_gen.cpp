@@ -0,0 +1,196 @@
+/* 흰 십자가 표 생성기
+ *
+ * VirtualCube.h의 1단계가 사용하는 흰 십자가 표(190,080가지 상태의 최소 면 회전 수, 4비트씩)를 BFS로 만들어 파일로 저장합니다.
+ * 상태마다 흰 엣지 네 개만 놓은 CubeState를 만들어 18가지 회전을 turn_cube_move()로 적용하므로 rotate()와 같은 회전 모델입니다.
+ * --header를 주면 ATmega1280/2560의 PROGMEM에 넣을 CrossTable.h도 씁니다(스케치에서 CUBE_CROSS_TABLE을 1로 정의해서 씁니다).
+ * 마지막으로 만든 표로 무작위 상태의 1단계를 풀어 보고, 예전 방식과 회전 수를 비교합니다.
+ *
+ * 사용법: cross_gen [출력 파일=cross.bin] [--header CrossTable.h]
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Arduino.h"
+#include "CrossFile.h"
+
+namespace {
+
+constexpr uint32_t CROSS_TABLE_PART = 31680;  // CROSS_TABLE_SIZE / 3, avr-gcc의 배열 하나는 32767바이트를 넘을 수 없습니다.
+constexpr uint8_t UNKNOWN = 15;
+
+[[noreturn]] void fail(const char* message) {
+  fprintf(stderr, "cross_gen: %s\n", message);
+  exit(1);
+}
+
+// cross_index()의 반대입니다. 흰 엣지가 아닌 자리에는 엣지 4..11을 차례로 방향 0으로 놓습니다.
+CubeState cross_state(uint32_t index) {
+  uint8_t orientations = index % 16;
+  index /= 16;
+  uint8_t ranks[4];
+  for (int8_t i = 3; i >= 0; --i) {
+    ranks[i] = index % (12 - i);
+    index /= 12 - i;
+  }
+  bool used[12] = {};
+  uint8_t positions[4];
+  for (uint8_t i = 0; i < 4; ++i) {
+    uint8_t pos = 0;
+    for (uint8_t rank = ranks[i];; ++pos) {
+      if (!used[pos] && rank-- == 0) {
+        break;
+      }
+    }
+    used[pos] = true;
+    positions[i] = pos;
+  }
+  CubeState state;
+  uint8_t other = 4;
+  for (uint8_t pos = 0; pos < 12; ++pos) {
+    if (!used[pos]) {
+      state.set_edge(pos, other++, 0);
+    }
+  }
+  for (uint8_t i = 0; i < 4; ++i) {
+    state.set_edge(positions[i], i, orientations >> i & 1);
+  }
+  return state;
+}
+
+uint8_t get_entry(const std::vector<uint8_t>& entries, uint32_t index) {
+  return entries[index / 2] >> (index % 2 * 4) & 15;
+}
+void set_entry(std::vector<uint8_t>& entries, uint32_t index, uint8_t value) {
+  uint8_t& entry = entries[index / 2];
+  entry = index % 2 == 0 ? (entry & 0xF0) | value : (entry & 0x0F) | value << 4;
+}
+
+std::vector<uint8_t> generate() {
+  std::vector<uint8_t> entries(CROSS_TABLE_SIZE, UNKNOWN | UNKNOWN << 4);
+  std::vector<uint32_t> frontier = { 0 };
+  set_entry(entries, 0, 0);
+  uint32_t filled = 1;
+  for (uint8_t depth = 0; !frontier.empty(); ++depth) {
+    printf("  depth %u: %6zu\n", depth, frontier.size());
+    std::vector<uint32_t> next_frontier;
+    for (uint32_t index : frontier) {
+      if (cross_index(cross_state(index)) != index) {
+        fail("cross_state() does not invert cross_index()");
+      }
+      for (uint8_t move = 0; move < MOVE_COUNT; ++move) {
+        CubeState next = cross_state(index);
+        turn_cube_move(next, move);
+        uint32_t next_index = cross_index(next);
+        if (get_entry(entries, next_index) == UNKNOWN) {
+          set_entry(entries, next_index, depth + 1);
+          next_frontier.push_back(next_index);
+        }
+      }
+    }
+    filled += next_frontier.size();
+    frontier.swap(next_frontier);
+  }
+  if (filled != CROSS_TABLE_COUNT) {
+    fail("not every cross state is reachable");
+  }
+  return entries;
+}
+
+bool cross_solved(const CubeState& state) {
+  for (uint8_t pos = 0; pos < 4; ++pos) {
+    if (state.edge_pos(pos) != pos || state.edge_ori(pos) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+// 1단계를 풀고 정리한 면 회전 수를 반환합니다.
+uint16_t cross_face_turns(const CubeState& state) {
+  cube = state;
+  container.clear();
+  solve_white_cross();
+  if (!cross_solved(cube)) {
+    fail("solve_white_cross() left the cross unsolved");
+  }
+  optimize_moves(container);
+  return container.length();
+}
+
+void write_header(const char* path, const std::vector<uint8_t>& entries) {
+  FILE* file = fopen(path, "wb");
+  if (file == nullptr) {
+    fail("cannot open the header file");
+  }
+  fprintf(file, "#ifndef CROSS_TABLE_H\r\n#define CROSS_TABLE_H\r\n\r\n");
+  fprintf(file, "// host/cross_gen.cpp가 만든 파일입니다. 직접 고치지 말고 생성기를 다시 실행하세요.\r\n");
+  fprintf(file, "// 형식은 VirtualCube.h의 \"흰 십자가 표\"를 참고하세요. 플래시가 128KB 이상인 AVR에서만 씁니다.\r\n\r\n");
+  fprintf(file, "constexpr uint32_t CROSS_TABLE_PART = %u;\r\n", CROSS_TABLE_PART);
+  for (uint8_t part = 0; part < 3; ++part) {
+    fprintf(file, "const uint8_t cross_table_%u[%u] PROGMEM = {", part, CROSS_TABLE_PART);
+    for (uint32_t i = 0; i < CROSS_TABLE_PART; ++i) {
+      fprintf(file, "%s%u,", i % 32 == 0 ? "\r\n  " : "", entries[part * CROSS_TABLE_PART + i]);
+    }
+    fprintf(file, "\r\n};\r\n");
+  }
+  fprintf(file, "\r\n#endif  // !CROSS_TABLE_H\r\n");
+  fclose(file);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* output = "cross.bin";
+  const char* header = nullptr;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--header") == 0 && i + 1 < argc) {
+      header = argv[++i];
+    } else {
+      output = argv[i];
+    }
+  }
+  static_assert(3 * CROSS_TABLE_PART == CROSS_TABLE_SIZE, "the header splits the table into three equal parts");
+
+  printf("cross states: %u\n", CROSS_TABLE_COUNT);
+  std::vector<uint8_t> entries = generate();
+
+  // 예전 방식과 표를 따르는 방식으로 같은 무작위 상태의 1단계를 풀어 비교합니다.
+  std::mt19937 rng(1);
+  constexpr uint32_t SAMPLES = 100000;
+  uint32_t before = 0, after = 0, before_worst = 0, after_worst = 0;
+  for (uint32_t n = 0; n < SAMPLES; ++n) {
+    CubeState state;
+    for (int i = 0; i < 30; ++i) {
+      turn_cube_move(state, rng() % MOVE_COUNT);
+    }
+    cross_table = nullptr;
+    uint16_t length = cross_face_turns(state);
+    before += length;
+    before_worst = std::max<uint32_t>(before_worst, length);
+    cross_table = entries.data();
+    length = cross_face_turns(state);
+    if (length != cross_distance(state)) {
+      fail("the table walk is not optimal");
+    }
+    after += length;
+    after_worst = std::max<uint32_t>(after_worst, length);
+  }
+  printf("stage 1     : face turns mean %.2f max %u (patterns) -> mean %.2f max %u (table), %u random states\n",
+         static_cast<double>(before) / SAMPLES, before_worst, static_cast<double>(after) / SAMPLES, after_worst, SAMPLES);
+
+  FILE* file = fopen(output, "wb");
+  if (file == nullptr || fwrite(entries.data(), 1, entries.size(), file) != entries.size() || fclose(file) != 0) {
+    fail("cannot write the table file");
+  }
+  if (!cross_table_load(output)) {
+    fail("cannot read back the table file");
+  }
+  printf("wrote %s (%zu bytes)\n", output, entries.size());
+  if (header != nullptr) {
+    write_header(header, entries);
+    printf("wrote %s\n", header);
+  }
+  return 0;
+}
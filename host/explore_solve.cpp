@@ -0,0 +1,285 @@
+/* solve() 최악 경우 탐색
+ *
+ * solve()의 반복 횟수는 상태에 따라 달라지므로 무작위 스크램블의 평균만으로는 장치에서 가장 오래 걸리는 경우를 알 수 없습니다.
+ * 아래 목표마다 가장 큰 값을 내는 상태를 찾아 보고합니다.
+ *   - SOLVE_LOOP_HOOK이 붙은 반복문(VirtualCube.h의 SOLVE_LOOP_*)의 solve() 한 번당 반복 수
+ *   - 1~4단계의 쿼터 턴 수(정리 전), 정리 전 전체 쿼터 턴 수(장치에서 rotate()를 부르는 횟수), 정리 후의 최종 해법 길이(면 회전)
+ * 먼저 무작위 상태를 뽑아 최댓값을 잡고, 다음으로 목표마다 언덕 오르기를 합니다.
+ * 무작위 상태에서 시작해서 1~2회 회전한 이웃이 목표 값을 줄이지 않으면 옮겨 가며(같은 값이면 평지를 따라 움직입니다) 다시 시작하기를 반복합니다.
+ * 찾은 상태는 solve() 해법을 거꾸로 돌린 스크램블로 출력하므로 bench_solve나 장치에서 그대로 재현할 수 있습니다.
+ *
+ * 반복 수 한도(bound 열)는 한 번 들어간 반복문이 돌 수 있는 횟수의 분석값입니다.
+ *   F2L slot       한 번에 칸 하나를 맞추므로 네 번이면 끝납니다.
+ *   F2L macros     두 층 표가 칸 하나에서 이어 수행하는 매크로 수는 표를 만들 때 정해집니다(FIRST_TWO_LAYERS_STEPS).
+ *   LL orientation 마지막 층 표가 한 상태에서 이어 수행하는 알고리즘 수도 같습니다(LAST_LAYER_ORIENTATION_STEPS).
+ *   LL permutation 위와 같습니다(LAST_LAYER_PERMUTATION_STEPS).
+ * 흰 십자가의 전체 반복(passes)은 분석값이 없으므로 찾은 최댓값을 봅니다.
+ *
+ * 마지막으로 만들 수 없는 상태(코너 하나 비틀기, 엣지 하나 뒤집기, 코너 둘 또는 엣지 둘 바꾸기)를 solve()에 넣어
+ * 끝나지 않는 반복문을 찾습니다. 한 반복문이 solve() 한 번에 EXPLORE_LOOP_LIMIT번을 넘게 돌면 끝나지 않는 것으로 봅니다.
+ * 장치의 cube는 rotate()로만 바뀌고 Offload.h는 받은 상태를 검사하므로, 이런 상태는 센서가 틀리지 않는 한 solve()에 들어가지 않습니다.
+ *
+ * 사용법: explore_solve [무작위 상태 수=100000] [다시 시작 수=8] [언덕 오르기 걸음 수=2000] [시드=1]
+ * 숫자가 아닌 인자나 남는 인자가 있으면 사용법을 출력하고 종료 코드 2로 끝납니다.
+ */
+
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+
+#include "Arduino.h"
+
+constexpr int SOLVE_STAGE_COUNT = 6;  // 1~5단계와 종료 지점
+uint16_t stage_marks[SOLVE_STAGE_COUNT + 1];
+#define SOLVE_STAGE_HOOK(stage) (stage_marks[(stage)] = container.length())
+void explore_loop(uint8_t site);
+#define SOLVE_LOOP_HOOK(site) explore_loop(site)
+
+#include "VirtualCube.h"
+
+static_assert(SOLVE_STAGE_COUNT == SOLVE_FINAL_STAGE + 1, "stage_marks must cover every stage of solve()");
+
+constexpr uint32_t EXPLORE_LOOP_LIMIT = 10000;
+uint32_t loop_counts[SOLVE_LOOP_COUNT];
+
+struct LoopLimit {
+  uint8_t site;
+};
+
+void explore_loop(uint8_t site) {
+  if (++loop_counts[site] > EXPLORE_LOOP_LIMIT) {
+    throw LoopLimit{ site };
+  }
+}
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int STAGE_OBJECTIVE = SOLVE_LOOP_COUNT;
+constexpr int RAW_OBJECTIVE = STAGE_OBJECTIVE + SOLVE_FINAL_STAGE - 1;
+constexpr int FACE_TURN_OBJECTIVE = RAW_OBJECTIVE + 1;
+constexpr int OBJECTIVE_COUNT = FACE_TURN_OBJECTIVE + 1;
+
+const char* const objective_names[OBJECTIVE_COUNT] = {
+  "loop white cross passes",
+  "loop F2L slot passes",
+  "loop F2L macros",
+  "loop LL orientation algs",
+  "loop LL permutation algs",
+  "stage 1 white cross",
+  "stage 2 first two layers",
+  "stage 3 LL orientation",
+  "stage 4 LL permutation",
+  "quarter turns before cleanup",
+  "solution face turns",
+};
+const std::string objective_bounds[OBJECTIVE_COUNT] = {
+  "-", "4/solve", std::to_string(FIRST_TWO_LAYERS_STEPS) + "/slot",
+  std::to_string(LAST_LAYER_ORIENTATION_STEPS) + "/solve", std::to_string(LAST_LAYER_PERMUTATION_STEPS) + "/solve",
+  "-", "-", "-", "-", "-", "-",
+};
+
+struct Metrics {
+  uint32_t values[OBJECTIVE_COUNT];
+  bool solved;
+};
+
+struct Best {
+  uint32_t value = 0;
+  CubeState state;
+};
+
+// state를 풀고 목표 값을 모두 잽니다. 해법은 container에 남습니다.
+Metrics evaluate(const CubeState& state) {
+  Metrics metrics;
+  cube = state;
+  memset(loop_counts, 0, sizeof(loop_counts));
+  solve();
+  for (int site = 0; site < SOLVE_LOOP_COUNT; ++site) {
+    metrics.values[site] = loop_counts[site];
+  }
+  for (int stage = 0; stage < SOLVE_FINAL_STAGE - 1; ++stage) {
+    metrics.values[STAGE_OBJECTIVE + stage] = stage_marks[stage + 2] - stage_marks[stage + 1];
+  }
+  metrics.values[RAW_OBJECTIVE] = stage_marks[SOLVE_FINAL_STAGE];
+  uint32_t face_turns = 0;
+  for (char c : container) {
+    uint8_t axis, count;
+    face_turns += parse_move_char(c, axis, count);
+  }
+  metrics.values[FACE_TURN_OBJECTIVE] = face_turns;
+  metrics.solved = cube.solved() && !container.overflowed();
+  return metrics;
+}
+
+CubeState random_state(std::mt19937& rng) {
+  CubeState state;
+  for (int i = 0; i < 40; ++i) {
+    turn_cube_move(state, rng() % 18);
+  }
+  return state;
+}
+
+void update(Best (&best)[OBJECTIVE_COUNT], const Metrics& metrics, const CubeState& state) {
+  for (int objective = 0; objective < OBJECTIVE_COUNT; ++objective) {
+    if (metrics.values[objective] > best[objective].value) {
+      best[objective].value = metrics.values[objective];
+      best[objective].state = state;
+    }
+  }
+}
+
+// solve() 해법을 거꾸로, 반대 방향으로 돌린 스크램블입니다.
+std::string scramble_of(const CubeState& state) {
+  evaluate(state);
+  std::string scramble;
+  for (uint16_t i = container.length(); i-- > 0;) {
+    char c = container.begin()[i];
+    scramble += c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c >= 'a' && c <= 'z' ? c - 'a' + 'A' : c;
+  }
+  return scramble;
+}
+
+double mean_solve_us(const CubeState& state, uint32_t repeats) {
+  Clock::time_point begin = Clock::now();
+  for (uint32_t i = 0; i < repeats; ++i) {
+    evaluate(state);
+  }
+  return std::chrono::duration<double, std::micro>(Clock::now() - begin).count() / repeats;
+}
+
+// 만들 수 없는 상태를 종류별로 넣어 보고 끝나지 않은 반복문을 셉니다.
+void explore_unreachable(std::mt19937& rng, uint32_t count) {
+  const char* const kinds[] = { "twisted corner", "flipped edge", "swapped corners", "swapped edges" };
+  printf("\nunreachable states (limit %u iterations per loop per solve):\n", EXPLORE_LOOP_LIMIT);
+  for (int kind = 0; kind < 4; ++kind) {
+    uint32_t stuck[SOLVE_LOOP_COUNT] = {};
+    uint32_t unsolved = 0, solved = 0;
+    for (uint32_t n = 0; n < count; ++n) {
+      CubeState state = random_state(rng);
+      uint8_t a = rng() % (kind % 2 == 0 ? 8 : 12), b = (a + 1 + rng() % (kind % 2 == 0 ? 7 : 11)) % (kind % 2 == 0 ? 8 : 12);
+      switch (kind) {
+        case 0: state.set_corner(a, state.corner_pos(a), (state.corner_ori(a) + 1) % 3); break;
+        case 1: state.set_edge(a, state.edge_pos(a), state.edge_ori(a) ^ 1); break;
+        case 2: {
+          uint8_t piece = state.corner_pos(a), ori = state.corner_ori(a);
+          state.set_corner(a, state.corner_pos(b), state.corner_ori(b));
+          state.set_corner(b, piece, ori);
+          break;
+        }
+        case 3: {
+          uint8_t piece = state.edge_pos(a), ori = state.edge_ori(a);
+          state.set_edge(a, state.edge_pos(b), state.edge_ori(b));
+          state.set_edge(b, piece, ori);
+          break;
+        }
+      }
+      try {
+        Metrics metrics = evaluate(state);
+        (metrics.solved ? solved : unsolved)++;
+      } catch (const LoopLimit& limit) {
+        stuck[limit.site]++;
+      }
+    }
+    printf("  %-16s: %u states, ended unsolved %u, solved %u", kinds[kind], count, unsolved, solved);
+    for (int site = 0; site < SOLVE_LOOP_COUNT; ++site) {
+      if (stuck[site] != 0) {
+        printf(", stuck in '%s' %u", objective_names[site], stuck[site]);
+      }
+    }
+    printf("\n");
+  }
+}
+
+int usage() {
+  fprintf(stderr, "usage: explore_solve [samples=100000] [restarts=8] [steps=2000] [seed=1]\n");
+  return 2;
+}
+
+// 10진수 인자 하나를 읽습니다. 끝까지 숫자가 아니거나 32비트를 넘으면 false를 반환합니다.
+bool parse_number(const char* text, uint32_t& value) {
+  char* end;
+  unsigned long parsed = strtoul(text, &end, 10);
+  if (!isdigit(static_cast<unsigned char>(text[0])) || *end != '\0' || parsed > 0xFFFFFFFFul) {
+    return false;
+  }
+  value = parsed;
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  uint32_t sample_count = 100000;
+  uint32_t restarts = 8;
+  uint32_t steps = 2000;
+  uint32_t seed = 1;
+  uint32_t* const values[4] = { &sample_count, &restarts, &steps, &seed };
+  if (argc > 5) {
+    return usage();
+  }
+  for (int i = 1; i < argc; ++i) {
+    if (!parse_number(argv[i], *values[i - 1])) {
+      return usage();
+    }
+  }
+
+  std::mt19937 rng(seed);
+  uint32_t failures = 0;
+
+  Best sampled[OBJECTIVE_COUNT];
+  double sampled_us = 0;
+  Clock::time_point begin = Clock::now();
+  for (uint32_t n = 0; n < sample_count; ++n) {
+    CubeState state = random_state(rng);
+    Metrics metrics = evaluate(state);
+    failures += !metrics.solved;
+    update(sampled, metrics, state);
+  }
+  sampled_us = std::chrono::duration<double, std::micro>(Clock::now() - begin).count() / (sample_count ? sample_count : 1);
+
+  Best climbed[OBJECTIVE_COUNT];
+  for (int objective = 0; objective < OBJECTIVE_COUNT; ++objective) {
+    for (uint32_t restart = 0; restart < restarts; ++restart) {
+      CubeState current = random_state(rng);
+      Metrics current_metrics = evaluate(current);
+      update(climbed, current_metrics, current);
+      for (uint32_t step = 0; step < steps; ++step) {
+        CubeState candidate = current;
+        for (uint32_t turns = 1 + rng() % 2; turns > 0; --turns) {
+          turn_cube_move(candidate, rng() % 18);
+        }
+        Metrics metrics = evaluate(candidate);
+        failures += !metrics.solved;
+        update(climbed, metrics, candidate);
+        if (metrics.values[objective] >= current_metrics.values[objective]) {
+          current = candidate;
+          current_metrics = metrics;
+        }
+      }
+    }
+  }
+
+  printf("random sampling  : %u states (seed %u), mean solve %.2f us\n", sample_count, seed, sampled_us);
+  printf("hill climbing    : %u restarts x %u steps per objective\n", restarts, steps);
+  printf("invalid solutions: %u\n", failures);
+  printf("\n%-30s %8s %8s %8s\n", "objective", "random", "climbed", "bound");
+  for (int objective = 0; objective < OBJECTIVE_COUNT; ++objective) {
+    printf("%-30s %8u %8u %8s\n", objective_names[objective], sampled[objective].value, climbed[objective].value,
+           objective_bounds[objective].c_str());
+  }
+  const Best& slowest = climbed[RAW_OBJECTIVE];
+  printf("\nslowest state    : %u quarter turns before cleanup, solve %.2f us (random mean %.2f us)\n", slowest.value,
+         mean_solve_us(slowest.state, 1000), sampled_us);
+  printf("\nworst states (scramble = inverse of the solve() solution):\n");
+  for (int objective = 0; objective < OBJECTIVE_COUNT; ++objective) {
+    const Best& best = climbed[objective].value >= sampled[objective].value ? climbed[objective] : sampled[objective];
+    printf("  %-28s %s\n", objective_names[objective], scramble_of(best.state).c_str());
+  }
+
+  explore_unreachable(rng, 1000);
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,322 @@
+/* 두 층 표 생성기
+ *
+ * VirtualCube.h의 2단계가 사용하는 칸 0의 경우 표와 칸별 경우 번호 표를 계산해서
+ * FirstTwoLayersTables.h(PROGMEM 배열)로 저장합니다. 표를 바꿀 때만 실행하면 됩니다.
+ *
+ * 먼저 트리거 24개를 맞춰진 상태에 적용해 보고, 흰 십자가를 그대로 두며 칸 하나(코너 자리 c, 엣지 자리 4 + c)와 노란 층만 바꾸는지 확인합니다.
+ * 다음으로 맞춰진 상태에서 18가지 회전으로 칸 0의 코너와 엣지가 갈 수 있는 곳을 모두 찾고, 같은 회전열의 옆면 축을 s칸 돌려
+ * 칸 s의 코너와 엣지가 가는 곳을 봐서 칸별 경우 번호 표를 만듭니다. 같은 경우가 두 곳으로 가면 멈춥니다.
+ * 표는 384가지 경우를 노드로, 매크로를 간선으로 두고 맞춰진 쌍에서 거꾸로 Dijkstra를 돌려 경우마다 첫 매크로를 고릅니다.
+ * 트리거는 칸 0의 것과, 쌍의 코너나 엣지가 들어 있는 칸의 것만 씁니다(그런 칸은 아직 맞지 않았으므로 흐트러져도 됩니다).
+ * 비용은 면 회전 수이며, 같으면 매크로가 적은 쪽을 고릅니다.
+ * 마지막으로 채운 표로 solve()를 돌려 무작위 상태가 실제로 풀리는지 확인합니다.
+ *
+ * 사용법: first_two_layers_gen [출력 파일=FirstTwoLayersTables.h]
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "Arduino.h"
+
+// 장치에서는 생성된 헤더의 상수와 PROGMEM 배열이지만, 여기서는 직접 계산해서 채웁니다.
+#define FIRST_TWO_LAYERS_NO_TABLES
+uint8_t first_two_layers_corner_case[4 * 24];
+uint8_t first_two_layers_edge_case[4 * 16];
+uint8_t first_two_layers_table[384];
+uint8_t FIRST_TWO_LAYERS_STEPS = 0xFF;
+
+#include "VirtualCube.h"
+
+namespace {
+
+constexpr uint8_t MACRO_COUNT = 27;
+constexpr uint8_t UNUSED = 0xFF;
+
+[[noreturn]] void fail(const char* message) {
+  fprintf(stderr, "first_two_layers_gen: %s\n", message);
+  exit(1);
+}
+
+void perform(CubeState& state, uint8_t macro, uint8_t slot) {
+  uint8_t moves[3];
+  uint8_t count = first_two_layers_moves(macro, slot, moves);
+  for (uint8_t i = 0; i < count; ++i) {
+    turn_cube_move(state, moves[i]);
+  }
+}
+uint8_t face_turns(uint8_t macro) {
+  return macro < 3 ? 1 : 3;
+}
+
+// 트리거마다 흐트러지는 칸입니다. 노란 면 회전은 UNUSED입니다.
+uint8_t trigger_slot[MACRO_COUNT];
+
+void check_triggers() {
+  for (uint8_t macro = 0; macro < MACRO_COUNT; ++macro) {
+    trigger_slot[macro] = UNUSED;
+    CubeState state;
+    perform(state, macro, 0);
+    for (uint8_t pos = 0; pos < 4; ++pos) {
+      if (state.edge_pos(pos) != pos || state.edge_ori(pos) != 0) {
+        fail("a macro moves a white cross edge");
+      }
+    }
+    uint8_t corner = UNUSED, edge = UNUSED, changed = 0;
+    for (uint8_t pos = 0; pos < 4; ++pos) {
+      if (state.corner_pos(pos) != pos || state.corner_ori(pos) != 0) {
+        corner = pos;
+        changed++;
+      }
+      if (state.edge_pos(4 + pos) != 4 + pos || state.edge_ori(4 + pos) != 0) {
+        edge = pos;
+        changed++;
+      }
+    }
+    if (macro < 3 ? changed != 0 : changed != 2 || corner != edge) {
+      fail("a trigger does not stay within one slot");
+    }
+    trigger_slot[macro] = corner;
+  }
+}
+
+uint8_t corner_case(const CubeState& state, uint8_t slot) {
+  for (uint8_t pos = 0; pos < 8; ++pos) {
+    if (state.corner_pos(pos) == slot) {
+      return pos * 3 + state.corner_ori(pos);
+    }
+  }
+  return UNUSED;
+}
+uint8_t edge_case(const CubeState& state, uint8_t slot) {  // 0..23, 흰 십자가 자리이면 16 이상입니다.
+  for (uint8_t pos = 0; pos < 12; ++pos) {
+    if (state.edge_pos(pos) == 4 + slot) {
+      return ((pos + 8) % 12) * 2 + state.edge_ori(pos);
+    }
+  }
+  return UNUSED;
+}
+
+// 칸 0의 코너와 엣지가 갈 수 있는 곳마다 맞춰진 상태에서 그곳까지의 회전열을 찾고, 칸별 경우 번호 표를 채웁니다.
+std::vector<CubeState> build_cases() {
+  constexpr uint16_t NODES = 24 * 24;
+  std::vector<bool> seen(NODES, false);
+  std::vector<uint16_t> parent(NODES, 0);
+  std::vector<uint8_t> parent_move(NODES, 0);
+  std::vector<CubeState> states(NODES);
+  std::vector<uint16_t> queue = { 0 };
+  seen[0] = true;
+  for (size_t head = 0; head < queue.size(); ++head) {
+    for (uint8_t move = 0; move < MOVE_COUNT; ++move) {
+      CubeState next = states[queue[head]];
+      turn_cube_move(next, move);
+      uint16_t node = corner_case(next, 0) * 24 + edge_case(next, 0);
+      if (!seen[node]) {
+        seen[node] = true;
+        parent[node] = queue[head];
+        parent_move[node] = move;
+        states[node] = next;
+        queue.push_back(node);
+      }
+    }
+  }
+  if (queue.size() != NODES) {
+    fail("not every pair position is reachable");
+  }
+
+  memset(first_two_layers_corner_case, UNUSED, sizeof(first_two_layers_corner_case));
+  memset(first_two_layers_edge_case, UNUSED, sizeof(first_two_layers_edge_case));
+  for (uint16_t node = 0; node < NODES; ++node) {
+    std::vector<uint8_t> path;
+    for (uint16_t at = node; at != 0; at = parent[at]) {
+      path.push_back(parent_move[at]);
+    }
+    std::reverse(path.begin(), path.end());
+    for (uint8_t slot = 0; slot < 4; ++slot) {
+      CubeState state;
+      for (uint8_t move : path) {
+        turn_cube_move(state, last_layer_axis(move_axis(move), slot) * 3 + move % 3);
+      }
+      uint8_t corner = corner_case(state, slot), edge = edge_case(state, slot);
+      uint8_t& corner_entry = first_two_layers_corner_case[slot * 24 + corner];
+      if (corner_entry != UNUSED && corner_entry != node / 24) {
+        fail("corner cases do not agree between slots");
+      }
+      corner_entry = node / 24;
+      if ((node % 24 < 16) != (edge < 16)) {
+        fail("an edge leaves the white cross positions in one slot only");
+      }
+      if (edge < 16) {
+        uint8_t& edge_entry = first_two_layers_edge_case[slot * 16 + edge];
+        if (edge_entry != UNUSED && edge_entry != node % 24) {
+          fail("edge cases do not agree between slots");
+        }
+        edge_entry = node % 24;
+      }
+    }
+  }
+
+  std::vector<CubeState> cases(FIRST_TWO_LAYERS_COUNT);
+  for (uint16_t node = 0; node < NODES; ++node) {
+    if (node % 24 < 16) {
+      cases[node / 24 * 16 + node % 24] = states[node];
+    }
+  }
+  return cases;
+}
+
+// 경우 index에서 매크로를 쓸 수 있는지 확인합니다. 칸 0의 트리거나, 쌍의 조각이 들어 있는 칸의 트리거만 됩니다.
+bool allowed(uint16_t index, uint8_t macro) {
+  uint8_t slot = trigger_slot[macro];
+  uint8_t corner_pos = index / 16 / 3, edge_pos = index % 16 / 2 + 4;
+  return slot == UNUSED || slot == 0 || corner_pos == slot || edge_pos == 4 + slot;
+}
+
+std::vector<uint32_t> cost, steps;
+
+void build_table(const std::vector<CubeState>& cases) {
+  struct Edge {
+    uint16_t from;
+    uint32_t weight;
+  };
+  std::vector<std::vector<Edge>> incoming(FIRST_TWO_LAYERS_COUNT);
+  std::vector<std::vector<uint16_t>> target(FIRST_TWO_LAYERS_COUNT, std::vector<uint16_t>(MACRO_COUNT));
+  for (uint16_t from = 0; from < FIRST_TWO_LAYERS_COUNT; ++from) {
+    for (uint8_t macro = 0; macro < MACRO_COUNT; ++macro) {
+      CubeState next = cases[from];
+      perform(next, macro, 0);
+      target[from][macro] = first_two_layers_index(next, 0);
+      if (allowed(from, macro)) {
+        incoming[target[from][macro]].push_back({ from, face_turns(macro) * 64u + 1 });
+      }
+    }
+  }
+  constexpr uint32_t INFINITE = 0xFFFFFFFF;
+  std::vector<uint32_t> distance(FIRST_TWO_LAYERS_COUNT, INFINITE);
+  std::priority_queue<std::pair<uint32_t, uint16_t>, std::vector<std::pair<uint32_t, uint16_t>>, std::greater<>> open;
+  distance[0] = 0;
+  open.push({ 0, 0 });
+  while (!open.empty()) {
+    std::pair<uint32_t, uint16_t> top = open.top();
+    open.pop();
+    if (top.first != distance[top.second]) {
+      continue;
+    }
+    for (const Edge& edge : incoming[top.second]) {
+      if (top.first + edge.weight < distance[edge.from]) {
+        distance[edge.from] = top.first + edge.weight;
+        open.push({ distance[edge.from], edge.from });
+      }
+    }
+  }
+
+  cost.assign(FIRST_TWO_LAYERS_COUNT, 0);
+  steps.assign(FIRST_TWO_LAYERS_COUNT, 0);
+  first_two_layers_table[0] = FIRST_TWO_LAYERS_DONE;
+  for (uint16_t from = 1; from < FIRST_TWO_LAYERS_COUNT; ++from) {
+    if (distance[from] == INFINITE) {
+      fail("a pair case cannot be solved with the triggers");
+    }
+    for (uint8_t macro = 0; macro < MACRO_COUNT; ++macro) {
+      uint16_t to = target[from][macro];
+      if (allowed(from, macro) && distance[to] != INFINITE && distance[to] + face_turns(macro) * 64 + 1 == distance[from]) {
+        first_two_layers_table[from] = macro;
+        break;
+      }
+    }
+    cost[from] = distance[from] / 64;
+    steps[from] = distance[from] % 64;
+  }
+  FIRST_TWO_LAYERS_STEPS = *std::max_element(steps.begin(), steps.end());
+}
+
+// PROGMEM 배열 하나를 쓰고 크기(바이트)를 반환합니다.
+size_t write_array(FILE* file, const char* name, const uint8_t* values, size_t size, const char* comment) {
+  fprintf(file, "// %s\r\nconst uint8_t %s[%zu] PROGMEM = {", comment, name, size);
+  for (size_t i = 0; i < size; ++i) {
+    fprintf(file, "%s%u,", i % 16 == 0 ? "\r\n  " : " ", values[i]);
+  }
+  fprintf(file, "\r\n};\r\n");
+  return size;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* output = argc > 1 ? argv[1] : "FirstTwoLayersTables.h";
+
+  check_triggers();
+  build_table(build_cases());
+
+  // 만든 표로 solve()를 돌려 확인하고, 2단계의 면 회전 수를 셉니다.
+  std::mt19937 rng(1);
+  uint32_t total = 0, worst = 0;
+  constexpr uint32_t SAMPLES = 100000;
+  for (uint32_t n = 0; n < SAMPLES; ++n) {
+    reset_cube();
+    for (int i = 0; i < 30; ++i) {
+      turn_cube_move(cube, rng() % MOVE_COUNT);
+    }
+    container.clear();
+    solve_white_cross();
+    uint16_t begin = container.length();
+    solve_first_two_layers();
+    MoveBuffer pairs;
+    for (uint16_t i = begin; i < container.length(); ++i) {
+      pairs.append(container[i]);
+    }
+    optimize_moves(pairs);
+    total += pairs.length();
+    worst = std::max<uint32_t>(worst, pairs.length());
+    for (uint8_t pos = 0; pos < 4; ++pos) {
+      if (cube.corner_pos(pos) != pos || cube.corner_ori(pos) != 0 || cube.edge_pos(4 + pos) != 4 + pos || cube.edge_ori(4 + pos) != 0) {
+        fail("solve_first_two_layers() left a slot unsolved");
+      }
+    }
+  }
+  for (uint32_t n = 0; n < SAMPLES; ++n) {
+    reset_cube();
+    for (int i = 0; i < 30; ++i) {
+      turn_cube_move(cube, rng() % MOVE_COUNT);
+    }
+    solve();
+    if (!cube.solved()) {
+      fail("solve() failed with the new tables");
+    }
+  }
+
+  FILE* file = fopen(output, "wb");
+  if (file == nullptr) {
+    fail("cannot open output file");
+  }
+  fprintf(file, "#ifndef FIRST_TWO_LAYERS_TABLES_H\r\n#define FIRST_TWO_LAYERS_TABLES_H\r\n\r\n");
+  fprintf(file, "// host/first_two_layers_gen.cpp가 만든 파일입니다. 직접 고치지 말고 생성기를 다시 실행하세요.\r\n");
+  fprintf(file, "// 매크로 번호와 경우 번호의 형식은 VirtualCube.h의 \"두 층 표\"를 참고하세요.\r\n\r\n");
+  fprintf(file, "constexpr uint8_t FIRST_TWO_LAYERS_STEPS = %u;\r\n\r\n", FIRST_TWO_LAYERS_STEPS);
+  size_t bytes = 0;
+  bytes += write_array(file, "first_two_layers_corner_case", first_two_layers_corner_case, sizeof(first_two_layers_corner_case),
+                       "칸 s의 코너가 자리 p에 방향 o로 있을 때 [s * 24 + p * 3 + o] -> 칸 0의 코너 경우(0..23)");
+  bytes += write_array(file, "first_two_layers_edge_case", first_two_layers_edge_case, sizeof(first_two_layers_edge_case),
+                       "칸 s의 엣지가 자리 p(4..11)에 방향 o로 있을 때 [s * 16 + (p - 4) * 2 + o] -> 칸 0의 엣지 경우(0..15)");
+  bytes += write_array(file, "first_two_layers_table", first_two_layers_table, sizeof(first_two_layers_table),
+                       "2단계: 코너 경우 * 16 + 엣지 경우 -> 다음 매크로");
+  fprintf(file, "\r\n#endif  // !FIRST_TWO_LAYERS_TABLES_H\r\n");
+  fclose(file);
+
+  uint32_t case_total = 0, case_worst = 0, step_total = 0;
+  for (uint16_t index = 0; index < FIRST_TWO_LAYERS_COUNT; ++index) {
+    case_total += cost[index];
+    case_worst = std::max(case_worst, cost[index]);
+    step_total += steps[index];
+  }
+  printf("pair cases : %u, face turns mean %.2f max %u, macros mean %.2f max %u\n", FIRST_TWO_LAYERS_COUNT,
+         static_cast<double>(case_total) / FIRST_TWO_LAYERS_COUNT, case_worst,
+         static_cast<double>(step_total) / FIRST_TWO_LAYERS_COUNT, FIRST_TWO_LAYERS_STEPS);
+  printf("stage 2    : face turns after cleanup mean %.2f max %u (%u random states)\n",
+         static_cast<double>(total) / SAMPLES, worst, SAMPLES);
+  printf("wrote %s (%zu bytes of PROGMEM)\n", output, bytes);
+  return 0;
+}
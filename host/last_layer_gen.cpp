@@ -0,0 +1,346 @@
+/* 마지막 층 표 생성기
+ *
+ * VirtualCube.h의 3, 4단계가 사용하는 방향 표와 위치 표, 알고리즘 목록을 계산해서
+ * LastLayerTables.h(PROGMEM 배열)로 저장합니다. 표를 바꿀 때만 실행하면 됩니다.
+ *
+ * 알고리즘은 잘 알려진 OLL/PLL을 보통 표기(U 윗면, F 앞면, R 오른쪽 면)로 적고 U=Y, D=W, F=G, B=B, R=O, L=R로 바꿔 씁니다.
+ * 알고리즘마다 두 층을 그대로 두는지(위치 알고리즘은 마지막 층의 방향까지) 먼저 확인하고, 하나라도 어긋나면 멈춥니다.
+ * 표의 칸을 노드로, (노란 면 회전 0~3번) + (알고리즘 없음 또는 알고리즘의 y 회전 0~3)을 간선으로 두고
+ * 맞춰진 칸에서 거꾸로 Dijkstra를 돌려 칸마다 첫 간선을 고릅니다. 비용은 면 회전 수이며, 같으면 간선이 적은 쪽을 고릅니다.
+ * 마지막으로 채운 표로 solve()를 돌려 무작위 상태가 실제로 풀리는지 확인합니다.
+ *
+ * 사용법: last_layer_gen [출력 파일=LastLayerTables.h]
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Arduino.h"
+
+// 장치에서는 생성된 헤더의 상수와 PROGMEM 배열이지만, 여기서는 직접 계산해서 채웁니다.
+#define LAST_LAYER_NO_TABLES
+uint8_t last_layer_moves[256];
+uint8_t last_layer_begin[32];
+uint8_t last_layer_orientation_table[216];
+uint8_t last_layer_permutation_table[288];
+uint8_t LAST_LAYER_PERMUTATION_FIRST;
+uint8_t LAST_LAYER_ORIENTATION_STEPS;
+uint8_t LAST_LAYER_PERMUTATION_STEPS;
+
+#include "VirtualCube.h"
+
+namespace {
+
+struct Algorithm {
+  const char* name;
+  const char* notation;
+};
+// 방향 단계(OLL)의 알고리즘입니다. 엣지 방향만 맞추는 것과 코너 방향만 맞추는 것이 모두 있어서 두세 번이면 모든 경우가 끝납니다.
+const Algorithm orientation_algorithms[] = {
+  { "OLL 45 (line)", "F R U R' U' F'" },
+  { "OLL 44 (L)", "F U R U' R' F'" },
+  { "OLL 27 (sune)", "R U R' U R U2 R'" },
+  { "OLL 26 (anti-sune)", "R U2 R' U' R U' R'" },
+  { "OLL 21 (H)", "F R U R' U' R U R' U' R U R' U' F'" },
+  { "OLL 22 (pi)", "R U2 R2 U' R2 U' R2 U2 R" },
+  { "OLL 23 (headlights)", "R2 D R' U2 R D' R' U2 R'" },
+  { "OLL 24 (chameleon)", "L F R' F' L' F R F'" },
+  { "OLL 25 (bowtie)", "F' L F R' F' L' F R" },
+};
+// 위치 단계(PLL)의 알고리즘입니다.
+const Algorithm permutation_algorithms[] = {
+  { "T", "R U R' U' R' F R2 U' R' U' R U R' F'" },
+  { "Ua", "R U' R U R U R U' R' U' R2" },
+  { "Ub", "R2 U R U R' U' R' U' R' U R'" },
+  { "H", "R2 U2 R U2 R2 U2 R2 U2 R U2 R2" },
+  { "Aa", "R' F R' B2 R F' R' B2 R2" },
+  { "Ab", "R2 B2 R F R' B2 R F' R" },
+  { "Ja", "R' U L' U2 R U' R' U2 R L U'" },
+  { "Jb", "R U R' F' R U R' U' R' F R2 U' R' U'" },
+  { "Y", "F R U' R' U' R U R' F' R U R' U' R' F R F'" },
+  { "F", "R' U' F' R U R' U' R' F R2 U' R' U' R U R' U R" },
+};
+
+[[noreturn]] void fail(const char* message, const char* detail = "") {
+  fprintf(stderr, "last_layer_gen: %s%s\n", message, detail);
+  exit(1);
+}
+
+// 보통 표기를 회전 번호 목록으로 바꿉니다.
+std::vector<uint8_t> parse(const char* notation) {
+  const char faces[] = "DUFBRL";  // 축 번호(W, Y, G, B, O, R) 순서의 보통 표기
+  std::vector<uint8_t> moves;
+  for (const char* c = notation; *c != '\0'; ++c) {
+    const char* face = *c == ' ' ? nullptr : strchr(faces, *c);
+    if (face == nullptr) {
+      continue;
+    }
+    uint8_t count = c[1] == '2' ? 2 : c[1] == '\'' ? 3 : 1;
+    moves.push_back((face - faces) * 3 + count - 1);
+  }
+  return moves;
+}
+
+void apply(CubeState& state, const std::vector<uint8_t>& moves, uint8_t rotation) {
+  for (uint8_t move : moves) {
+    turn_cube_move(state, last_layer_axis(move_axis(move), rotation) * 3 + move % 3);
+  }
+}
+
+bool first_two_layers_solved(const CubeState& state) {
+  for (uint8_t pos = 0; pos < 4; ++pos) {
+    if (state.corner_pos(pos) != pos || state.corner_ori(pos) != 0) {
+      return false;
+    }
+  }
+  for (uint8_t pos = 0; pos < 8; ++pos) {
+    if (state.edge_pos(pos) != pos || state.edge_ori(pos) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+bool last_layer_oriented(const CubeState& state) {
+  return last_layer_orientation_index(state) == 0;
+}
+
+struct Phase {
+  const char* name;
+  const Algorithm* algorithms;
+  size_t algorithm_count;
+  uint16_t node_count;
+  uint16_t (*index)(const CubeState&);
+  std::vector<std::vector<uint8_t>> moves;  // 알고리즘마다 회전 번호 목록
+  std::vector<uint8_t> table;
+  std::vector<uint32_t> cost;  // 칸마다 끝날 때까지의 면 회전 수
+  std::vector<uint8_t> steps;  // 칸마다 끝날 때까지 수행하는 칸 수
+};
+
+uint16_t orientation_index(const CubeState& state) {
+  return last_layer_orientation_index(state);
+}
+uint16_t permutation_index(const CubeState& state) {
+  return last_layer_permutation_index(state);
+}
+
+void load_algorithms(Phase& phase, bool keep_orientation) {
+  for (size_t i = 0; i < phase.algorithm_count; ++i) {
+    std::vector<uint8_t> moves = parse(phase.algorithms[i].notation);
+    CubeState state;
+    apply(state, moves, 0);
+    if (!first_two_layers_solved(state) || (keep_orientation && !last_layer_oriented(state)) || state.solved()) {
+      fail("algorithm does not fit its phase: ", phase.algorithms[i].name);
+    }
+    phase.moves.push_back(moves);
+  }
+}
+
+// 칸 값을 간선 하나로 수행합니다. 장치의 last_layer_perform()과 같은 규칙입니다.
+CubeState perform(const Phase& phase, CubeState state, uint8_t entry) {
+  for (uint8_t i = 0; i < (entry & 3); ++i) {
+    state.turn(static_cast<uint8_t>(Color::Y));
+  }
+  if (entry >> 4 != 0) {
+    apply(state, phase.moves[(entry >> 4) - 1], entry >> 2 & 3);
+  }
+  return state;
+}
+
+void build(Phase& phase) {
+  // 맞춰진 상태에서 간선을 따라 칸마다 대표 상태를 찾습니다. 방향 칸의 전이는 방향에만 달려 있으므로 대표 하나로 충분합니다.
+  std::vector<uint8_t> entries;
+  for (uint8_t turns = 1; turns < 4; ++turns) {
+    entries.push_back(turns);
+  }
+  for (uint8_t algorithm = 0; algorithm < phase.moves.size(); ++algorithm) {
+    for (uint8_t rotation = 0; rotation < 4; ++rotation) {
+      for (uint8_t turns = 0; turns < 4; ++turns) {
+        entries.push_back((algorithm + 1) << 4 | rotation << 2 | turns);
+      }
+    }
+  }
+  std::vector<CubeState> states(phase.node_count);
+  std::vector<bool> seen(phase.node_count, false);
+  std::vector<uint16_t> queue = { 0 };
+  seen[0] = true;
+  for (size_t head = 0; head < queue.size(); ++head) {
+    for (uint8_t entry : entries) {
+      CubeState next = perform(phase, states[queue[head]], entry);
+      uint16_t index = phase.index(next);
+      if (!seen[index]) {
+        seen[index] = true;
+        states[index] = next;
+        queue.push_back(index);
+      }
+    }
+  }
+  if (queue.size() != phase.node_count) {
+    fail("not every case is reachable in phase ", phase.name);
+  }
+
+  // 간선 (칸 -> 칸, 비용)을 모아 거꾸로 Dijkstra를 돌립니다. 비용은 면 회전 수 * 64 + 1(간선 수)입니다.
+  struct Edge {
+    uint16_t from;
+    uint32_t weight;
+  };
+  std::vector<std::vector<Edge>> incoming(phase.node_count);
+  for (uint16_t from = 0; from < phase.node_count; ++from) {
+    for (uint8_t entry : entries) {
+      uint32_t face_turns = (entry & 3) != 0;
+      if (entry >> 4 != 0) {
+        face_turns += phase.moves[(entry >> 4) - 1].size();
+      }
+      incoming[phase.index(perform(phase, states[from], entry))].push_back({ from, face_turns * 64 + 1 });
+    }
+  }
+  constexpr uint32_t INFINITE = 0xFFFFFFFF;
+  std::vector<uint32_t> distance(phase.node_count, INFINITE);
+  std::priority_queue<std::pair<uint32_t, uint16_t>, std::vector<std::pair<uint32_t, uint16_t>>, std::greater<>> open;
+  distance[0] = 0;
+  open.push({ 0, 0 });
+  while (!open.empty()) {
+    std::pair<uint32_t, uint16_t> top = open.top();
+    open.pop();
+    if (top.first != distance[top.second]) {
+      continue;
+    }
+    for (const Edge& edge : incoming[top.second]) {
+      if (top.first + edge.weight < distance[edge.from]) {
+        distance[edge.from] = top.first + edge.weight;
+        open.push({ distance[edge.from], edge.from });
+      }
+    }
+  }
+
+  phase.table.assign(phase.node_count, LAST_LAYER_DONE);
+  phase.cost.assign(phase.node_count, 0);
+  phase.steps.assign(phase.node_count, 0);
+  for (uint16_t from = 1; from < phase.node_count; ++from) {
+    for (uint8_t entry : entries) {
+      uint32_t face_turns = (entry & 3) != 0;
+      if (entry >> 4 != 0) {
+        face_turns += phase.moves[(entry >> 4) - 1].size();
+      }
+      uint16_t to = phase.index(perform(phase, states[from], entry));
+      if (distance[to] != INFINITE && distance[to] + face_turns * 64 + 1 == distance[from]) {
+        phase.table[from] = entry;
+        break;
+      }
+    }
+    phase.cost[from] = distance[from] / 64;
+    phase.steps[from] = distance[from] % 64;
+  }
+}
+
+template <typename T>
+void write_values(FILE* file, const std::vector<T>& values, const char* indent) {
+  for (size_t i = 0; i < values.size(); ++i) {
+    fprintf(file, "%s%s%u,", i % 16 == 0 ? "\r\n" : " ", i % 16 == 0 ? indent : "", static_cast<unsigned>(values[i]));
+  }
+}
+// PROGMEM 배열 하나를 쓰고 크기(바이트)를 반환합니다.
+size_t write_array(FILE* file, const char* name, const std::vector<uint8_t>& values, const char* comment) {
+  fprintf(file, "// %s\r\nconst uint8_t %s[%zu] PROGMEM = {", comment, name, values.size());
+  write_values(file, values, "  ");
+  fprintf(file, "\r\n};\r\n");
+  return values.size();
+}
+
+void report(const Phase& phase) {
+  uint32_t total = 0, worst = 0, steps = 0, worst_steps = 0;
+  for (uint16_t index = 0; index < phase.node_count; ++index) {
+    total += phase.cost[index];
+    worst = std::max(worst, phase.cost[index]);
+    steps += phase.steps[index];
+    worst_steps = std::max<uint32_t>(worst_steps, phase.steps[index]);
+  }
+  printf("%-11s: %u cases, face turns mean %.2f max %u, steps mean %.2f max %u\n", phase.name, phase.node_count,
+         static_cast<double>(total) / phase.node_count, worst, static_cast<double>(steps) / phase.node_count, worst_steps);
+}
+uint8_t max_steps(const Phase& phase) {
+  return *std::max_element(phase.steps.begin(), phase.steps.end());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* output = argc > 1 ? argv[1] : "LastLayerTables.h";
+
+  Phase orientation = { "orientation", orientation_algorithms, sizeof(orientation_algorithms) / sizeof(Algorithm),
+                        LAST_LAYER_ORIENTATION_COUNT, orientation_index, {}, {}, {}, {} };
+  Phase permutation = { "permutation", permutation_algorithms, sizeof(permutation_algorithms) / sizeof(Algorithm),
+                        LAST_LAYER_PERMUTATION_COUNT, permutation_index, {}, {}, {}, {} };
+  load_algorithms(orientation, false);
+  load_algorithms(permutation, true);
+  build(orientation);
+  build(permutation);
+
+  // 알고리즘 회전 번호를 한 줄로 잇고 시작 위치를 적습니다. 위치 알고리즘은 방향 알고리즘 뒤에 둡니다.
+  std::vector<uint8_t> moves, begin;
+  for (const Phase* phase : { &orientation, &permutation }) {
+    for (const std::vector<uint8_t>& algorithm : phase->moves) {
+      begin.push_back(moves.size());
+      moves.insert(moves.end(), algorithm.begin(), algorithm.end());
+    }
+  }
+  begin.push_back(moves.size());
+  if (moves.size() > sizeof(last_layer_moves) || begin.size() > sizeof(last_layer_begin)
+      || orientation.moves.size() >= 15 || permutation.moves.size() >= 15) {
+    fail("too many algorithms");
+  }
+
+  // 만든 표로 solve()를 돌려 확인합니다.
+  memcpy(last_layer_moves, moves.data(), moves.size());
+  memcpy(last_layer_begin, begin.data(), begin.size());
+  memcpy(last_layer_orientation_table, orientation.table.data(), orientation.table.size());
+  memcpy(last_layer_permutation_table, permutation.table.data(), permutation.table.size());
+  LAST_LAYER_PERMUTATION_FIRST = orientation.moves.size();
+  LAST_LAYER_ORIENTATION_STEPS = max_steps(orientation);
+  LAST_LAYER_PERMUTATION_STEPS = max_steps(permutation);
+  std::mt19937 rng(1);
+  for (uint32_t n = 0; n < 100000; ++n) {
+    reset_cube();
+    for (int i = 0; i < 30; ++i) {
+      turn_cube_move(cube, rng() % MOVE_COUNT);
+    }
+    solve();
+    if (!cube.solved()) {
+      fail("solve() failed with the new tables");
+    }
+  }
+
+  FILE* file = fopen(output, "wb");
+  if (file == nullptr) {
+    fail("cannot open output file");
+  }
+  fprintf(file, "#ifndef LAST_LAYER_TABLES_H\r\n#define LAST_LAYER_TABLES_H\r\n\r\n");
+  fprintf(file, "// host/last_layer_gen.cpp가 만든 파일입니다. 직접 고치지 말고 생성기를 다시 실행하세요.\r\n");
+  fprintf(file, "// 알고리즘은 회전 번호(axis * 3 + count - 1)이며, 칸 값의 형식은 VirtualCube.h의 \"마지막 층 표\"를 참고하세요.\r\n");
+  fprintf(file, "//\r\n");
+  uint8_t number = 0;
+  for (const Phase* phase : { &orientation, &permutation }) {
+    for (size_t i = 0; i < phase->algorithm_count; ++i, ++number) {
+      fprintf(file, "//   %2u %-20s %s\r\n", number, phase->algorithms[i].name, phase->algorithms[i].notation);
+    }
+  }
+  fprintf(file, "\r\n");
+  fprintf(file, "constexpr uint8_t LAST_LAYER_PERMUTATION_FIRST = %u;\r\n", static_cast<unsigned>(orientation.moves.size()));
+  fprintf(file, "constexpr uint8_t LAST_LAYER_ORIENTATION_STEPS = %u;\r\n", max_steps(orientation));
+  fprintf(file, "constexpr uint8_t LAST_LAYER_PERMUTATION_STEPS = %u;\r\n\r\n", max_steps(permutation));
+  size_t bytes = 0;
+  bytes += write_array(file, "last_layer_moves", moves, "알고리즘의 회전 번호를 이어 붙인 것");
+  bytes += write_array(file, "last_layer_begin", begin, "알고리즘 i는 last_layer_moves[begin[i]..begin[i + 1])");
+  bytes += write_array(file, "last_layer_orientation_table", orientation.table, "3단계: 방향 칸 -> 다음 칸 값");
+  bytes += write_array(file, "last_layer_permutation_table", permutation.table, "4단계: 위치 칸 -> 다음 칸 값");
+  fprintf(file, "\r\n#endif  // !LAST_LAYER_TABLES_H\r\n");
+  fclose(file);
+
+  report(orientation);
+  report(permutation);
+  printf("wrote %s (%zu bytes of PROGMEM)\n", output, bytes);
+  return 0;
+}
@@ -0,0 +1,268 @@
+/* 해법 맡기기 서버
+ *
+ * 시리얼 장치에서 Offload.h의 요청을 받아 해법을 구하고 4비트 답으로 돌려줍니다.
+ * CRC가 틀리거나 만들 수 없는 상태의 요청에는 답하지 않습니다(장치는 OFFLOAD_TIMEOUT_MS 뒤에 solve()로 대신합니다).
+ * 기본 해법은 two-phase이며, --budget(ms) 안에 찾지 못하면 solve()로 대신합니다. 예산은 장치의 OFFLOAD_TIMEOUT_MS보다 짧아야 합니다.
+ * neutral은 host/ColorNeutral.h로 대칭 --frames개(기본 48)의 시점을 모든 코어에 나눠 풀어 가장 짧은 층별 해법을 보냅니다.
+ *
+ * --pty는 장치 없이 확인하는 모드입니다. pty 한 쌍의 한쪽에서 서버를 돌리고 다른 쪽에 Serial을 연결한 뒤,
+ * Offload.h의 장치 쪽 함수(offload_request(), offload_receive())로 무작위 상태를 보내 받은 해법으로 맞춰지는지 확인하고
+ * 왕복 시간과 주고받은 바이트 수를 보고합니다. 마지막으로 서버를 멈춘 채 요청해서 OFFLOAD_TIMEOUT_MS 뒤에 만료되는지 확인합니다.
+ * 서버와 장치 쪽이 각자 cube와 container를 쓰므로 CUBE_THREAD_LOCAL을 thread_local로 정의합니다.
+ *
+ * 사용법: offload_server <시리얼 장치> [--baud 115200] [--solver two-phase|thistlethwaite|lbl|neutral] [--budget 300] [--frames 48]
+ *         offload_server --pty [요청 수=100] [시드=1] [--solver ...] [--budget ...]
+ */
+
+#include <poll.h>
+#include <termios.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "Arduino.h"
+
+#define CUBE_THREAD_LOCAL thread_local
+#include "ColorNeutral.h"
+#include "Offload.h"
+#include "Thistlethwaite.h"
+#include "TwoPhase.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+  const char* solver = "two-phase";
+  uint32_t budget_ms = 300;
+  uint8_t frames = CUBE_SYMMETRY_COUNT;
+  bool verbose = true;
+};
+
+speed_t baud_constant(uint32_t baud) {
+  switch (baud) {
+    case 9600: return B9600;
+    case 19200: return B19200;
+    case 38400: return B38400;
+    case 57600: return B57600;
+    case 230400: return B230400;
+    default: return B115200;
+  }
+}
+
+int open_serial(const char* path, uint32_t baud) {
+  int fd = open(path, O_RDWR | O_NOCTTY);
+  if (fd < 0) {
+    return -1;
+  }
+  termios settings;
+  if (tcgetattr(fd, &settings) == 0) {
+    cfmakeraw(&settings);
+    cfsetispeed(&settings, baud_constant(baud));
+    cfsetospeed(&settings, baud_constant(baud));
+    tcsetattr(fd, TCSANOW, &settings);
+  }
+  return fd;
+}
+
+// 이 스레드의 cube로 상태를 풀고 container의 해법을 답으로 만듭니다.
+size_t solve_request(uint8_t sequence, const uint8_t* state, const Options& options, uint8_t* response) {
+  cube = offload_read_state(state);
+  if (strcmp(options.solver, "two-phase") == 0) {
+    two_phase_solve(TWO_PHASE_MAX_LENGTH, options.budget_ms);
+  } else if (strcmp(options.solver, "thistlethwaite") == 0) {
+    thistlethwaite_solve();
+  } else if (strcmp(options.solver, "neutral") == 0) {
+    color_neutral_solve(options.frames, std::max(1u, std::thread::hardware_concurrency()));
+  } else {
+    solve();
+  }
+  response[0] = OFFLOAD_RESPONSE_SYNC;
+  response[1] = sequence;
+  return 2 + offload_encode(container.begin(), container.length(), response + 2);
+}
+
+// stop이 켜질 때까지 fd에서 요청을 받아 답합니다. 요청 사이의 쓰레기 바이트는 건너뜁니다.
+void serve(int fd, const Options& options, const std::atomic<bool>& stop) {
+  std::vector<uint8_t> pending;
+  uint8_t response[2 + MOVE_BUFFER_CAPACITY + 1];
+  while (!stop.load()) {
+    pollfd entry = { fd, POLLIN, 0 };
+    if (poll(&entry, 1, 50) <= 0) {
+      continue;
+    }
+    uint8_t buffer[256];
+    ssize_t size = read(fd, buffer, sizeof(buffer));
+    if (size <= 0) {
+      continue;
+    }
+    pending.insert(pending.end(), buffer, buffer + size);
+    while (true) {
+      auto sync = std::find(pending.begin(), pending.end(), OFFLOAD_REQUEST_SYNC);
+      pending.erase(pending.begin(), sync);
+      if (pending.size() < OFFLOAD_REQUEST_SIZE) {
+        break;
+      }
+      const uint8_t* frame = pending.data();
+      if (offload_crc8(frame + 1, OFFLOAD_STATE_SIZE + 1) != frame[OFFLOAD_REQUEST_SIZE - 1]) {
+        pending.erase(pending.begin());  // 다음 동기 바이트부터 다시 찾습니다.
+        continue;
+      }
+      if (offload_state_valid(frame + 2)) {
+        Clock::time_point begin = Clock::now();
+        size_t length = solve_request(frame[1], frame + 2, options, response);
+        for (size_t written = 0; written < length;) {
+          ssize_t result = write(fd, response + written, length - written);
+          written += result > 0 ? result : 0;
+        }
+        if (options.verbose) {
+          fprintf(stderr, "#%u: %u moves, %zu bytes, %.1f ms\n", frame[1], container.length(), length,
+                  std::chrono::duration<double, std::milli>(Clock::now() - begin).count());
+        }
+      } else if (options.verbose) {
+        fprintf(stderr, "#%u: invalid state\n", frame[1]);
+      }
+      pending.erase(pending.begin(), pending.begin() + OFFLOAD_REQUEST_SIZE);
+    }
+  }
+}
+
+double percentile(std::vector<double> values, double p) {
+  std::sort(values.begin(), values.end());
+  return values.empty() ? 0 : values[static_cast<size_t>(p * (values.size() - 1))];
+}
+
+// pty로 장치 쪽 함수를 확인합니다. 실패한 수를 반환합니다.
+int run_pty(uint32_t count, uint32_t seed, Options options) {
+  int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+    fprintf(stderr, "offload_server: cannot open a pty\n");
+    return 1;
+  }
+  int slave = open_serial(ptsname(master), OFFLOAD_BAUD);
+  if (slave < 0) {
+    fprintf(stderr, "offload_server: cannot open %s\n", ptsname(master));
+    return 1;
+  }
+  options.verbose = false;
+  std::atomic<bool> stop(false);
+  std::thread server([&] { serve(slave, options, stop); });
+  Serial.attach(master);
+
+  std::mt19937 rng(seed);
+  std::vector<double> round_trip_ms;
+  uint32_t failures = 0, face_turns = 0, response_bytes = 0;
+  for (uint32_t n = 0; n < count; ++n) {
+    CubeState scrambled;
+    for (int i = 0; i < 25; ++i) {
+      turn_cube_move(scrambled, rng() % 18);
+    }
+    cube = scrambled;
+    container.clear();
+    Clock::time_point begin = Clock::now();
+    offload_request();
+    bool received = false;
+    while (!(received = offload_receive()) && !offload_expired()) {
+      std::this_thread::yield();
+    }
+    round_trip_ms.push_back(std::chrono::duration<double, std::milli>(Clock::now() - begin).count());
+
+    CubeState check = scrambled;
+    for (char c : container) {
+      uint8_t axis, count;
+      if (parse_move_char(c, axis, count)) {
+        turn_cube_move(check, axis * 3 + count - 1);
+      }
+    }
+    failures += !received || !cube.solved() || !check.solved();
+    uint8_t response[2 + MOVE_BUFFER_CAPACITY + 1];
+    face_turns += container.length();
+    response_bytes += 2 + offload_encode(container.begin(), container.length(), response);
+  }
+
+  stop = true;
+  server.join();
+  cube = CubeState();
+  turn_cube_move(cube, 0);
+  container.clear();
+  Clock::time_point begin = Clock::now();
+  offload_request();
+  while (!offload_receive() && !offload_expired()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  double timeout_ms = std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+  bool timed_out = offload_state != OffloadState::IDLE && container.length() == 0;
+  offload_cancel();
+  close(slave);
+  close(master);
+
+  double mean_bytes = count == 0 ? 0 : static_cast<double>(response_bytes) / count;
+  printf("requests         : %u (solver %s, budget %u ms)\n", count, options.solver, options.budget_ms);
+  printf("invalid solutions: %u\n", failures);
+  printf("round trip (pty) : p50 %.2f ms, p99 %.2f ms, max %.2f ms\n", percentile(round_trip_ms, 0.5),
+         percentile(round_trip_ms, 0.99), percentile(round_trip_ms, 1.0));
+  printf("solution         : mean %.2f face turns\n", count == 0 ? 0 : static_cast<double>(face_turns) / count);
+  printf("bytes            : request %u, response mean %.2f (%u bps: %.2f ms + %.2f ms)\n", OFFLOAD_REQUEST_SIZE,
+         mean_bytes, OFFLOAD_BAUD, OFFLOAD_REQUEST_SIZE * 10000.0 / OFFLOAD_BAUD, mean_bytes * 10000.0 / OFFLOAD_BAUD);
+  printf("no server        : %s after %.0f ms (OFFLOAD_TIMEOUT_MS %u)\n", timed_out ? "expired" : "NOT EXPIRED",
+         timeout_ms, OFFLOAD_TIMEOUT_MS);
+  return failures + !timed_out;
+}
+
+int usage() {
+  fprintf(stderr, "usage: offload_server <serial device> [--baud N] [--solver two-phase|thistlethwaite|lbl|neutral] [--budget ms]\n"
+                  "                      [--frames N]\n"
+                  "       offload_server --pty [count] [seed] [--solver ...] [--budget ms] [--frames N]\n");
+  return 2;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options options;
+  uint32_t baud = OFFLOAD_BAUD;
+  std::vector<const char*> positional;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--baud") == 0 && i + 1 < argc) {
+      baud = strtoul(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--solver") == 0 && i + 1 < argc) {
+      options.solver = argv[++i];
+      if (strcmp(options.solver, "two-phase") != 0 && strcmp(options.solver, "thistlethwaite") != 0 &&
+          strcmp(options.solver, "lbl") != 0 && strcmp(options.solver, "neutral") != 0) {
+        return usage();
+      }
+    } else if (strcmp(argv[i], "--budget") == 0 && i + 1 < argc) {
+      options.budget_ms = strtoul(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      options.frames = std::min<unsigned long>(CUBE_SYMMETRY_COUNT, std::max(1ul, strtoul(argv[++i], nullptr, 10)));
+    } else {
+      positional.push_back(argv[i]);
+    }
+  }
+  if (positional.empty()) {
+    return usage();
+  }
+  if (strcmp(options.solver, "two-phase") == 0) {
+    two_phase_init();
+  }
+  if (strcmp(positional[0], "--pty") == 0) {
+    uint32_t count = positional.size() > 1 ? strtoul(positional[1], nullptr, 10) : 100;
+    uint32_t seed = positional.size() > 2 ? strtoul(positional[2], nullptr, 10) : 1;
+    return run_pty(count, seed, options) == 0 ? 0 : 1;
+  }
+
+  int fd = open_serial(positional[0], baud);
+  if (fd < 0) {
+    fprintf(stderr, "offload_server: cannot open %s\n", positional[0]);
+    return 1;
+  }
+  fprintf(stderr, "serving %s at %u bps (solver %s)\n", positional[0], baud, options.solver);
+  std::atomic<bool> stop(false);
+  serve(fd, options, stop);
+  return 0;
+}
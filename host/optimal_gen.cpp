@@ -0,0 +1,110 @@
+/* 최적 해법 PDB 생성기
+ *
+ * host/Optimal.h가 mmap으로 읽는 패턴 데이터베이스 세 개를 만들어 파일로 저장합니다.
+ * 한 번만 실행하면 되며, 이후 optimal_solve는 파일을 매핑만 합니다.
+ *
+ * 맞춰진 상태에서 시작하는 깊이별 BFS입니다. 각 깊이에서 표 전체를 훑으며
+ * 아직 절반이 채워지지 않았으면 현재 깊이의 번호에서 앞으로 넓히고,
+ * 절반 이상 채워졌으면 빈 번호마다 이웃 중 현재 깊이가 있는지 거꾸로 확인합니다.
+ *
+ * 사용법: optimal_gen [출력 디렉터리=pdb]
+ */
+
+#include <sys/stat.h>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Arduino.h"
+#include "Optimal.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+uint8_t get_entry(const std::vector<uint8_t>& entries, uint32_t index) {
+  return entries[index / 2] >> (index % 2 * 4) & 15;
+}
+void set_entry(std::vector<uint8_t>& entries, uint32_t index, uint8_t value) {
+  uint8_t shift = index % 2 * 4;
+  entries[index / 2] = (entries[index / 2] & ~(15 << shift)) | value << shift;
+}
+
+std::vector<uint8_t> generate(uint8_t kind) {
+  const uint32_t count = pattern_entry_count(kind);
+  std::vector<uint8_t> entries((count + 1) / 2, 0xFF);
+  set_entry(entries, pattern_index(kind, piece_state_solved()), 0);
+  uint32_t filled = 1;
+  Clock::time_point begin = Clock::now();
+
+  for (uint8_t depth = 0; filled < count; ++depth) {
+    if (depth + 1 >= PDB_UNKNOWN) {
+      fprintf(stderr, "optimal_gen: depth does not fit in 4 bits\n");
+      exit(1);
+    }
+    const bool backward = filled > count / 2;
+    uint32_t added = 0;
+    PieceState state = piece_state_solved();
+    for (uint32_t index = 0; index < count; ++index) {
+      uint8_t value = get_entry(entries, index);
+      if (value != (backward ? PDB_UNKNOWN : depth)) {
+        continue;
+      }
+      pattern_decode(kind, index, state);
+      for (uint8_t move = 0; move < MOVE_COUNT; ++move) {
+        PieceState next = state;
+        piece_state_apply(next, move);
+        uint32_t next_index = pattern_index(kind, next);
+        if (backward) {
+          if (get_entry(entries, next_index) == depth) {
+            set_entry(entries, index, depth + 1);
+            added++;
+            break;
+          }
+        } else if (get_entry(entries, next_index) == PDB_UNKNOWN) {
+          set_entry(entries, next_index, depth + 1);
+          added++;
+        }
+      }
+    }
+    if (added == 0) {
+      fprintf(stderr, "optimal_gen: %s has unreachable entries\n", pattern_file_names[kind]);
+      exit(1);
+    }
+    filled += added;
+    printf("  depth %2u: %10u (%s, %.1f s)\n", depth + 1, added, backward ? "backward" : "forward",
+           std::chrono::duration<double>(Clock::now() - begin).count());
+  }
+  return entries;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::string directory = argc > 1 ? argv[1] : "pdb";
+  mkdir(directory.c_str(), 0755);
+  piece_moves_init();
+
+  for (uint8_t kind = 0; kind < PATTERN_COUNT; ++kind) {
+    printf("%s: %u entries\n", pattern_file_names[kind], pattern_entry_count(kind));
+    std::vector<uint8_t> entries = generate(kind);
+
+    // 다른 프로세스가 쓰다 만 파일을 매핑하지 않도록 임시 파일에 쓴 뒤 이름을 바꿉니다.
+    std::string path = directory + "/" + pattern_file_names[kind];
+    std::string temp_path = path + ".tmp";
+    PatternFileHeader header = {};
+    memcpy(header.magic, PATTERN_FILE_MAGIC, sizeof(header.magic));
+    header.kind = kind;
+    header.entry_count = pattern_entry_count(kind);
+    FILE* file = fopen(temp_path.c_str(), "wb");
+    if (file == nullptr || fwrite(&header, sizeof(header), 1, file) != 1
+        || fwrite(entries.data(), 1, entries.size(), file) != entries.size() || fclose(file) != 0
+        || rename(temp_path.c_str(), path.c_str()) != 0) {
+      fprintf(stderr, "optimal_gen: cannot write %s\n", path.c_str());
+      return 1;
+    }
+  }
+  return 0;
+}
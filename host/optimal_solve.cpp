@@ -0,0 +1,108 @@
+/* 최적 해법 도구
+ *
+ * optimal_gen이 만든 PDB를 매핑하고 스크램블마다 최적 해법(HTM)을 출력합니다.
+ * 스크램블은 해법과 같은 알파벳(대문자 90도 시계, 소문자 90도 반시계, 축 번호 숫자 180도)으로 적습니다.
+ * 인자로 스크램블을 주지 않으면 표준 입력에서 한 줄에 하나씩 읽습니다.
+ * --random을 주면 시드가 고정된 무작위 스크램블을 만들어 풀고, 해법이 스크램블보다 길지 않은지도 확인합니다.
+ *
+ * 사용법: optimal_solve <PDB 디렉터리> [스크램블 ...]
+ *         optimal_solve <PDB 디렉터리> --random <개수> <스크램블 길이> [시드=1]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Arduino.h"
+#include "Optimal.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// 스크램블을 맞춰진 상태에 적용합니다. 알파벳이 아닌 문자(공백 등)는 무시합니다.
+bool apply_scramble(const std::string& scramble) {
+  reset_cube();
+  for (char c : scramble) {
+    uint8_t axis, count;
+    if (parse_move_char(c, axis, count)) {
+      turn_cube_move(cube, axis * 3 + count - 1);
+    } else if (c != ' ' && c != '\t' && c != '\r') {
+      return false;
+    }
+  }
+  return true;
+}
+
+// 스크램블 하나를 풀어 한 줄로 출력하고, 해법이 맞는지 반환합니다.
+bool solve_and_print(const std::string& scramble, int max_length) {
+  if (!apply_scramble(scramble)) {
+    printf("%s: invalid scramble\n", scramble.c_str());
+    return false;
+  }
+  Clock::time_point begin = Clock::now();
+  int length = optimal_solve(max_length);
+  double ms = std::chrono::duration<double, std::milli>(Clock::now() - begin).count();
+  if (length < 0) {
+    printf("%s: no solution within %d moves (%llu nodes, %.1f ms)\n", scramble.c_str(), max_length,
+           static_cast<unsigned long long>(optimal_node_count), ms);
+    return false;
+  }
+  std::string solution(container.begin(), container.end());
+  apply_scramble(scramble + solution);
+  bool valid = cube.solved();
+  printf("%s: %s (%d moves, %llu nodes, %.1f ms)%s\n", scramble.c_str(), solution.c_str(), length,
+         static_cast<unsigned long long>(optimal_node_count), ms, valid ? "" : " INVALID");
+  fflush(stdout);
+  return valid;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: optimal_solve <pdb directory> [scramble ...]\n"
+                    "       optimal_solve <pdb directory> --random <count> <length> [seed]\n");
+    return 2;
+  }
+  Clock::time_point begin = Clock::now();
+  if (!optimal_init(argv[1])) {
+    fprintf(stderr, "optimal_solve: cannot map pattern databases in %s (run optimal_gen first)\n", argv[1]);
+    return 1;
+  }
+  printf("pattern databases mapped in %.2f ms\n",
+         std::chrono::duration<double, std::milli>(Clock::now() - begin).count());
+
+  uint32_t failures = 0;
+  if (argc > 2 && strcmp(argv[2], "--random") == 0) {
+    const uint32_t count = argc > 3 ? strtoul(argv[3], nullptr, 10) : 10;
+    const uint32_t length = argc > 4 ? strtoul(argv[4], nullptr, 10) : 10;
+    std::mt19937 rng(argc > 5 ? strtoul(argv[5], nullptr, 10) : 1);
+    for (uint32_t n = 0; n < count; ++n) {
+      std::string scramble;
+      for (uint32_t i = 0; i < length; ++i) {
+        char c = color_char[rng() % 6];
+        scramble += rng() % 2 ? c : static_cast<char>(c - 'A' + 'a');
+      }
+      failures += !solve_and_print(scramble, length);
+    }
+  } else if (argc > 2) {
+    for (int i = 2; i < argc; ++i) {
+      failures += !solve_and_print(argv[i], 20);
+    }
+  } else {
+    char line[1024];
+    while (fgets(line, sizeof(line), stdin) != nullptr) {
+      std::string scramble(line);
+      while (!scramble.empty() && (scramble.back() == '\n' || scramble.back() == '\r')) {
+        scramble.pop_back();
+      }
+      if (!scramble.empty()) {
+        failures += !solve_and_print(scramble, 20);
+      }
+    }
+  }
+  return failures == 0 ? 0 : 1;
+}
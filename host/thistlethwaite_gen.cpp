@@ -0,0 +1,320 @@
+/* Thistlethwaite 표 생성기
+ *
+ * Thistlethwaite.h가 사용하는 단계별 최소 회전 수 표와 작은 보조 표를 계산해서
+ * ThistlethwaiteTables.h(PROGMEM 배열)로 저장합니다. 표를 바꿀 때만 실행하면 됩니다.
+ *
+ * 각 표는 목표 상태에서 시작하는 BFS로 만듭니다. 좌표마다 처음 도달한 큐브 상태를 대표로 두고
+ * 그 상태를 돌려서 다음 좌표를 구하므로, 장치 코드와 같은 좌표 함수(get 방향)만 있으면 됩니다.
+ *
+ * 사용법: thistlethwaite_gen [출력 파일=ThistlethwaiteTables.h]
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Arduino.h"
+
+// 장치에서는 생성된 헤더의 상수와 PROGMEM 배열이지만, 여기서는 직접 계산해서 채웁니다.
+#define THISTLETHWAITE_NO_TABLES
+uint8_t TW_TETRAD_MASK;
+uint16_t TW_M_SLICE_MASK;
+uint16_t TW_PHASE3_SOLVED;
+uint8_t tw_tetrad_relabel[24];
+uint8_t tw_s4_class[24];
+uint16_t tw_half_turn_corners[96];
+
+#include "Thistlethwaite.h"
+
+namespace {
+
+struct State {
+  uint8_t c_pos[8], c_ori[8], e_pos[12], e_ori[12];
+};
+
+State solved_state() {
+  reset_cube();
+  State state;
+  cube.unpack(state.c_pos, state.c_ori, state.e_pos, state.e_ori);
+  return state;
+}
+void load(const State& state) {
+  memcpy(tw_corner_pos, state.c_pos, 8);
+  memcpy(tw_corner_ori, state.c_ori, 8);
+  memcpy(tw_edge_pos, state.e_pos, 12);
+  memcpy(tw_edge_ori, state.e_ori, 12);
+}
+State moved(State state, uint8_t move) {
+  turn_cubies_move(state.c_pos, state.c_ori, state.e_pos, state.e_ori, move);
+  return state;
+}
+
+[[noreturn]] void fail(const char* message) {
+  fprintf(stderr, "thistlethwaite_gen: %s\n", message);
+  exit(1);
+}
+
+// 180도 회전만으로 만들 수 있는 코너 배치(96가지)를 구합니다.
+std::vector<State> half_turn_corner_states() {
+  std::vector<State> states = { solved_state() };
+  std::set<uint16_t> seen = { get_corner_perm(states[0].c_pos) };
+  for (size_t i = 0; i < states.size(); ++i) {
+    for (uint8_t axis = 0; axis < 6; ++axis) {
+      State next = moved(states[i], axis * 3 + 1);
+      if (seen.insert(get_corner_perm(next.c_pos)).second) {
+        states.push_back(next);
+      }
+    }
+  }
+  return states;
+}
+
+uint16_t perm_index(const uint8_t (&perm)[4]) {
+  return get_perm(perm, 4);
+}
+
+// 단계와 부분 좌표 하나에 대해 목표 상태에서 BFS를 해서 좌표별 최소 회전 수를 구합니다.
+std::vector<uint8_t> bfs(uint8_t phase, uint8_t part, uint32_t count, const char* name) {
+  std::vector<uint8_t> distance(count, 0xFF);
+  std::deque<State> queue = { solved_state() };
+  load(queue.front());
+  distance[tw_coordinate(phase, part)] = 0;
+  uint32_t reached = 1;
+  uint8_t max_distance = 0;
+  while (!queue.empty()) {
+    State state = queue.front();
+    queue.pop_front();
+    load(state);
+    uint8_t current = distance[tw_coordinate(phase, part)];
+    for (uint8_t move = 0; move < MOVE_COUNT; ++move) {
+      if (!tw_move_allowed(phase, move)) {
+        continue;
+      }
+      State next = moved(state, move);
+      load(next);
+      uint16_t coordinate = tw_coordinate(phase, part);
+      if (coordinate >= count) {
+        fail("coordinate out of range");
+      }
+      if (distance[coordinate] == 0xFF) {
+        distance[coordinate] = current + 1;
+        max_distance = std::max<uint8_t>(max_distance, current + 1);
+        reached++;
+        queue.push_back(next);
+      }
+    }
+  }
+
+  // 좌표가 상태의 함수로 잘 정의되었는지, 무작위 상태에서 이웃의 거리가 1 이내로만 바뀌는지 확인합니다.
+  std::mt19937 rng(phase * 2 + part);
+  State state = solved_state();
+  for (int i = 0; i < 200000; ++i) {
+    uint8_t move;
+    do {
+      move = rng() % MOVE_COUNT;
+    } while (!tw_move_allowed(phase, move));
+    load(state);
+    int before = distance[tw_coordinate(phase, part)];
+    state = moved(state, move);
+    load(state);
+    int after = distance[tw_coordinate(phase, part)];
+    if (before == 0xFF || after == 0xFF || abs(before - after) > 1) {
+      fail("inconsistent coordinate");
+    }
+  }
+
+  printf("phase %u part %u %-8s: %6u coordinates reached of %6u, max distance %u\n", phase + 1, part, name, reached,
+         count, max_distance);
+  return distance;
+}
+
+// 거리를 3으로 나눈 나머지를 2비트씩 묶습니다. 도달하지 못한 좌표는 TW_UNREACHED입니다.
+std::vector<uint8_t> pack_mod3(const std::vector<uint8_t>& distance) {
+  std::vector<uint8_t> packed((distance.size() + 3) / 4, 0);
+  for (size_t i = 0; i < distance.size(); ++i) {
+    uint8_t value = distance[i] == 0xFF ? TW_UNREACHED : distance[i] % 3;
+    packed[i / 4] |= value << (i % 4 * 2);
+  }
+  return packed;
+}
+
+template <typename T>
+void write_values(FILE* file, const std::vector<T>& values, const char* indent) {
+  for (size_t i = 0; i < values.size(); ++i) {
+    fprintf(file, "%s%s%u,", i % 16 == 0 ? "\r\n" : " ", i % 16 == 0 ? indent : "", static_cast<unsigned>(values[i]));
+  }
+}
+
+// PROGMEM 배열 하나를 쓰고 크기(바이트)를 반환합니다.
+template <typename T>
+size_t write_array(FILE* file, const char* type, const char* name, const std::vector<T>& values, const char* comment) {
+  fprintf(file, "// %s\r\nconst %s %s[%zu] PROGMEM = {", comment, type, name, values.size());
+  write_values(file, values, "  ");
+  fprintf(file, "\r\n};\r\n");
+  return values.size() * sizeof(T);
+}
+size_t write_rows(FILE* file, const char* name, const std::vector<std::vector<uint8_t>>& rows, const char* comment) {
+  fprintf(file, "// %s\r\nconst uint8_t %s[%zu][%zu] PROGMEM = {", comment, name, rows.size(), rows[0].size());
+  for (const std::vector<uint8_t>& row : rows) {
+    fprintf(file, "\r\n  {");
+    write_values(file, row, "    ");
+    fprintf(file, "\r\n  },");
+  }
+  fprintf(file, "\r\n};\r\n");
+  return rows.size() * rows[0].size();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* output = argc > 1 ? argv[1] : "ThistlethwaiteTables.h";
+
+  // 1. 180도 회전 코너 배치와 두 묶음
+  std::vector<State> half_turn = half_turn_corner_states();
+  if (half_turn.size() != TW_HALF_TURN_CORNER_COUNT) {
+    fail("unexpected half-turn corner group size");
+  }
+  std::vector<uint16_t> half_turn_corners;
+  TW_TETRAD_MASK = 0;
+  for (const State& state : half_turn) {
+    half_turn_corners.push_back(get_corner_perm(state.c_pos));
+    TW_TETRAD_MASK |= 1 << state.c_pos[0];
+  }
+  std::sort(half_turn_corners.begin(), half_turn_corners.end());
+  std::copy(half_turn_corners.begin(), half_turn_corners.end(), tw_half_turn_corners);
+  if (__builtin_popcount(TW_TETRAD_MASK) != 4) {
+    fail("corner tetrad is not four pieces");
+  }
+
+  // O, R 면에 닿지 않는 윗면/아랫면 엣지입니다.
+  TW_M_SLICE_MASK = 0;
+  for (uint8_t edge : ud_edge_positions) {
+    bool on_side = false;
+    for (uint8_t axis : { static_cast<uint8_t>(Color::O), static_cast<uint8_t>(Color::R) }) {
+      for (uint8_t target : edge_rotation_target[axis]) {
+        on_side |= target == edge;
+      }
+    }
+    if (!on_side) {
+      TW_M_SLICE_MASK |= 1 << edge;
+    }
+  }
+  if (__builtin_popcount(TW_M_SLICE_MASK) != 4) {
+    fail("M slice is not four edges");
+  }
+
+  // 2. 묶음 A를 자리 순서대로 바꿔 붙이는 배치의 B 부분과 S4/V4 분류
+  constexpr uint8_t normal_v4[4][4] = { { 0, 1, 2, 3 }, { 1, 0, 3, 2 }, { 2, 3, 0, 1 }, { 3, 2, 1, 0 } };
+  std::set<uint16_t> kernel;
+  bool relabel_found[24] = {};
+  for (const State& state : half_turn) {
+    uint8_t a_part[4], b_part[4], a_inverse[4];
+    uint8_t found_a = 0, found_b = 0;
+    for (uint8_t label = 0; label < 8; ++label) {
+      uint8_t rank = tw_rank_in(TW_TETRAD_MASK, state.c_pos[label]);
+      if (TW_TETRAD_MASK >> label & 1) {
+        if (!(TW_TETRAD_MASK >> state.c_pos[label] & 1)) {
+          fail("half turns mix the corner tetrads");
+        }
+        a_part[found_a++] = rank;
+      } else {
+        b_part[found_b++] = rank;
+      }
+    }
+    for (uint8_t i = 0; i < 4; ++i) {
+      a_inverse[a_part[i]] = i;
+    }
+    uint8_t key = get_perm(a_inverse, 4);
+    if (key == 0) {
+      kernel.insert(get_perm(b_part, 4));
+    }
+    if (!relabel_found[key]) {
+      relabel_found[key] = true;
+      tw_tetrad_relabel[key] = get_perm(b_part, 4);
+    }
+  }
+  std::set<uint16_t> expected_kernel;
+  for (const auto& v : normal_v4) {
+    expected_kernel.insert(perm_index(v));
+  }
+  if (kernel != expected_kernel || std::count(relabel_found, relabel_found + 24, true) != 24) {
+    fail("half-turn corner group does not have the expected S4 x V4 structure");
+  }
+  memset(tw_s4_class, 0xFF, sizeof(tw_s4_class));
+  for (uint8_t index = 0, next_class = 0; index < 24; ++index) {
+    if (tw_s4_class[index] != 0xFF) {
+      continue;
+    }
+    uint8_t sigma[4];
+    set_perm(sigma, 4, index);
+    for (const auto& v : normal_v4) {
+      uint8_t product[4];
+      for (uint8_t i = 0; i < 4; ++i) {
+        product[i] = sigma[v[i]];
+      }
+      tw_s4_class[perm_index(product)] = next_class;
+    }
+    next_class++;
+  }
+
+  // 3단계 코너 좌표가 코너 배치 40320가지를 정확히 420가지로 나누는지 확인합니다.
+  load(solved_state());
+  std::set<uint16_t> phase3_corners;
+  for (uint16_t corner_perm = 0; corner_perm < CORNER_PERM_COUNT; ++corner_perm) {
+    set_corner_perm(tw_corner_pos, corner_perm);
+    phase3_corners.insert(tw_phase3_corner());
+  }
+  if (phase3_corners.size() != 420) {
+    fail("phase 3 corner coordinate does not split into 420 cosets");
+  }
+  load(solved_state());
+  TW_PHASE3_SOLVED = tw_coordinate(2, 0);
+
+  // 3. 단계별 표
+  std::vector<uint8_t> flip = bfs(0, 0, FLIP_COUNT, "flip");
+  std::vector<uint8_t> twist = bfs(1, 0, TWIST_COUNT, "twist");
+  std::vector<uint8_t> slice = bfs(1, 1, SLICE_COUNT, "slice");
+  std::vector<uint8_t> phase3 = bfs(2, 0, TW_PHASE3_COUNT, "tetrads");
+  std::vector<uint8_t> corner_layer[3];
+  for (uint8_t layer = 0; layer < 3; ++layer) {
+    corner_layer[layer] = bfs(3, layer, TW_PHASE4_CORNER_LAYER_COUNT, "corners+layer");
+  }
+  std::vector<uint8_t> edge = bfs(3, 3, TW_PHASE4_EDGE_COUNT, "edges");
+
+  FILE* file = fopen(output, "wb");
+  if (file == nullptr) {
+    fail("cannot open output file");
+  }
+  fprintf(file, "#ifndef THISTLETHWAITE_TABLES_H\r\n#define THISTLETHWAITE_TABLES_H\r\n\r\n");
+  fprintf(file, "// host/thistlethwaite_gen.cpp가 만든 파일입니다. 직접 고치지 말고 생성기를 다시 실행하세요.\r\n");
+  fprintf(file, "// 거리 표는 최소 회전 수 %% 3을 2비트씩 저장합니다(3은 도달할 수 없는 좌표).\r\n\r\n");
+  fprintf(file, "constexpr uint8_t TW_TETRAD_MASK = 0x%02X;\r\n", TW_TETRAD_MASK);
+  fprintf(file, "constexpr uint16_t TW_M_SLICE_MASK = 0x%03X;\r\n", TW_M_SLICE_MASK);
+  fprintf(file, "constexpr uint16_t TW_PHASE3_SOLVED = %u;\r\n\r\n", TW_PHASE3_SOLVED);
+  size_t bytes = 0;
+  bytes += write_array(file, "uint8_t", "tw_tetrad_relabel",
+                       std::vector<uint8_t>(tw_tetrad_relabel, tw_tetrad_relabel + 24),
+                       "A 묶음 순서(순열 번호)를 자리 순서로 바꾸는 180도 회전 배치의 B 부분(순열 번호)");
+  bytes += write_array(file, "uint8_t", "tw_s4_class", std::vector<uint8_t>(tw_s4_class, tw_s4_class + 24),
+                       "순열 번호 -> S4/V4 분류(0..5)");
+  bytes += write_array(file, "uint16_t", "tw_half_turn_corners", half_turn_corners,
+                       "180도 회전 코너 배치의 corner_perm(정렬됨)");
+  bytes += write_array(file, "uint8_t", "tw_flip_distance", pack_mod3(flip), "1단계: flip");
+  bytes += write_array(file, "uint8_t", "tw_twist_distance", pack_mod3(twist), "2단계: twist");
+  bytes += write_array(file, "uint8_t", "tw_slice_distance", pack_mod3(slice), "2단계: 가운데 층 엣지의 자리");
+  bytes += write_array(file, "uint8_t", "tw_phase3_distance", pack_mod3(phase3),
+                       "3단계: 코너 묶음과 순서 * 70 + 엣지 층");
+  bytes += write_rows(file, "tw_corner_layer_distance",
+                      { pack_mod3(corner_layer[0]), pack_mod3(corner_layer[1]), pack_mod3(corner_layer[2]) },
+                      "4단계: 코너 * 24 + 층(M, S, E) 하나의 엣지 순서");
+  bytes += write_array(file, "uint8_t", "tw_edge_distance", pack_mod3(edge), "4단계: 엣지");
+  fprintf(file, "\r\n#endif  // !THISTLETHWAITE_TABLES_H\r\n");
+  fclose(file);
+
+  printf("wrote %s (%zu bytes of PROGMEM)\n", output, bytes);
+  return 0;
+}
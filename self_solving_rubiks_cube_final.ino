@@ -1,13 +1,23 @@
 /* 0. 목차
  * 
  * VirtualCube   1: 1. 함수 인자로 사용하기 위한 enum
- * VirtualCube  29: 2. 큐브의 저장 방식
- * VirtualCube 133: 3. 그 긴거
+ * VirtualCube  66: 2. 큐브의 저장 방식
+ * VirtualCube 376: 3. 그 긴거
  * 
- * PhysicalCube 16: 1. 센서와 모터
- * PhysicalCube 76: 2. 메인 로직 함수
+ * PhysicalCube  30: 1. 센서와 모터
+ * PhysicalCube 576: 2. 메인 로직 함수
  */
 
+// 해법을 바꾸려면 아래 줄의 주석을 푸세요. (PhysicalCube.h의 CUBE_SOLVER 참고)
+// #define CUBE_SOLVER CUBE_SOLVER_THISTLETHWAITE
+// #define CUBE_SOLVER CUBE_SOLVER_OFFLOAD  // host/offload_server가 연결되어 있을 때
+// 단계별 시간과 모터 기록을 Serial로 보려면 아래 줄의 주석을 푸세요. (Telemetry.h 참고)
+// #define CUBE_TELEMETRY 1
+// ATmega1280/2560에서 최적의 흰 십자가 표(약 93KB)를 쓰려면 cross_gen --header CrossTable.h로 만든 뒤 아래 줄의 주석을 푸세요. (VirtualCube.h 참고)
+// #define CUBE_CROSS_TABLE 1
+// 미리 풀기 동안 큐브를 다르게 잡은 시점들에서도 풀어 가장 짧은 해법을 쓰려면 아래 줄의 주석을 푸세요. (PhysicalCube.h의 CUBE_NEUTRAL_FRAMES 참고)
+// #define CUBE_NEUTRAL_FRAMES 24
+
 #include "VirtualCube.h"
 #include "PhysicalCube.h"
 